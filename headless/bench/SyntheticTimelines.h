@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CameraPath.h"
+
+#include <random>
+
+namespace FCFW::Headless {
+    // Synthetic key sequences for benchmarks and replay checks, deterministic per seed.
+    //  kOrbit:      evenly timed keys on a circle around a subject, camera looking at the center
+    //  kRandomWalk: unevenly timed keys with bounded random steps in position, angles and FOV
+    //  kRecorded:   60 Hz keys of a slow pan with hand-held jitter, like a path recorded in game
+    enum class SyntheticShape {
+        kOrbit,
+        kRandomWalk,
+        kRecorded
+    };
+
+    struct SyntheticKey {
+        float m_time;
+        RE::NiPoint3 m_position;
+        RE::NiPoint3 m_rotation;  // pitch=x, roll=y, yaw=z (radians)
+        float m_fov;
+    };
+
+    inline const char* SyntheticShapeName(SyntheticShape a_shape) {
+        switch (a_shape) {
+            case SyntheticShape::kOrbit: return "orbit";
+            case SyntheticShape::kRandomWalk: return "randomWalk";
+            case SyntheticShape::kRecorded: return "recorded";
+        }
+        return "unknown";
+    }
+
+    inline std::vector<SyntheticKey> GenerateSyntheticKeys(SyntheticShape a_shape, size_t a_count, std::uint32_t a_seed = 1) {
+        std::vector<SyntheticKey> keys;
+        keys.reserve(a_count);
+        std::mt19937 random(a_seed);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+        switch (a_shape) {
+            case SyntheticShape::kOrbit: {
+                constexpr float radius = 800.0f;
+                constexpr float keysPerTurn = 16.0f;
+                for (size_t i = 0; i < a_count; ++i) {
+                    const float angle = 2.0f * PI * static_cast<float>(i) / keysPerTurn;
+                    const RE::NiPoint3 position{ radius * std::sin(angle), radius * std::cos(angle), 200.0f };
+                    keys.push_back(SyntheticKey{ static_cast<float>(i) * 0.5f, position, RE::NiPoint3{ 0.2f, 0.0f, _ts_SKSEFunctions::NormalRelativeAngle(angle + PI) }, 70.0f });
+                }
+                break;
+            }
+            case SyntheticShape::kRandomWalk: {
+                SyntheticKey key{ 0.0f, RE::NiPoint3{}, RE::NiPoint3{}, 80.0f };
+                for (size_t i = 0; i < a_count; ++i) {
+                    keys.push_back(key);
+                    key.m_time += 0.25f + 0.75f * (unit(random) + 1.0f);
+                    key.m_position += RE::NiPoint3{ unit(random), unit(random), 0.25f * unit(random) } * 300.0f;
+                    key.m_rotation.x = std::clamp(key.m_rotation.x + 0.2f * unit(random), -1.2f, 1.2f);
+                    key.m_rotation.y = 0.1f * unit(random);
+                    key.m_rotation.z = _ts_SKSEFunctions::NormalRelativeAngle(key.m_rotation.z + 0.8f * unit(random));
+                    key.m_fov = std::clamp(key.m_fov + 5.0f * unit(random), 40.0f, 110.0f);
+                }
+                break;
+            }
+            case SyntheticShape::kRecorded: {
+                constexpr float frameTime = 1.0f / 60.0f;
+                for (size_t i = 0; i < a_count; ++i) {
+                    const float time = static_cast<float>(i) * frameTime;
+                    const RE::NiPoint3 drift{ 150.0f * time, 40.0f * std::sin(0.5f * time), 120.0f };
+                    const RE::NiPoint3 jitter{ unit(random), unit(random), unit(random) };
+                    const RE::NiPoint3 rotation{ 0.1f * std::sin(0.3f * time) + 0.004f * unit(random), 0.002f * unit(random),
+                                                 _ts_SKSEFunctions::NormalRelativeAngle(0.2f * time) + 0.004f * unit(random) };
+                    keys.push_back(SyntheticKey{ time, drift + jitter * 1.5f, rotation, 75.0f });
+                }
+                break;
+            }
+        }
+        return keys;
+    }
+
+    inline TranslationPoint MakeTranslationPoint(const SyntheticKey& a_key, InterpolationMode a_mode) {
+        return TranslationPoint(Transition(a_key.m_time, a_mode, false, false), PointType::kWorld, a_key.m_position);
+    }
+
+    inline RotationPoint MakeRotationPoint(const SyntheticKey& a_key, InterpolationMode a_mode) {
+        return RotationPoint(Transition(a_key.m_time, a_mode, false, false), PointType::kWorld, a_key.m_rotation);
+    }
+
+    inline FOVPoint MakeFOVPoint(const SyntheticKey& a_key, InterpolationMode a_mode) {
+        return FOVPoint(Transition(a_key.m_time, a_mode, false, false), a_key.m_fov);
+    }
+}
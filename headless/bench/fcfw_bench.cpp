@@ -0,0 +1,769 @@
+// Microbenchmarks of the timeline engine on synthetic paths (see SyntheticTimelines.h).
+// JSON for comparing releases: fcfw-bench --benchmark_out=fcfw_bench.json --benchmark_out_format=json
+
+#include "Timeline.h"
+#include "PlaybackStateWord.h"
+#include "PluginHandleCache.h"
+#include "FCFW_Utils.h"
+#include "SyntheticTimelines.h"
+#include "TimelineVersionSlot.h"
+
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <mutex>
+#include <numbers>
+#include <unordered_map>
+
+namespace {
+    using FCFW::Headless::SyntheticShape;
+
+    constexpr size_t kMinKeys = 10;
+    constexpr size_t kMaxKeys = 100000;
+    constexpr size_t kQueriesPerIteration = 1024;
+
+    template <typename Track, typename MakePoint>
+    void FillTrack(Track& a_track, const std::vector<FCFW::Headless::SyntheticKey>& a_keys, FCFW::InterpolationMode a_mode, MakePoint a_makePoint) {
+        for (const auto& key : a_keys) {
+            a_track.AddPoint(a_makePoint(key, a_mode));
+        }
+    }
+
+    std::string ModeLabel(FCFW::InterpolationMode a_mode, bool a_loop, SyntheticShape a_shape) {
+        return FCFW::InterpolationModeToString(a_mode) + (a_loop ? "/loop/" : "/end/") + FCFW::Headless::SyntheticShapeName(a_shape);
+    }
+
+    // Playback-like lookups: evenly stepped times over the whole track (loop mode runs into the loop segment)
+    template <typename Track, auto MakePoint>
+    void BM_GetPointAtTime(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const auto mode = static_cast<FCFW::InterpolationMode>(a_state.range(1));
+        const bool loop = a_state.range(2) != 0;
+        const auto shape = static_cast<SyntheticShape>(a_state.range(3));
+
+        Track track;
+        FillTrack(track, FCFW::Headless::GenerateSyntheticKeys(shape, keyCount), mode, MakePoint);
+        if (loop) {
+            track.SetPlaybackMode(FCFW::PlaybackMode::kLoop);
+            track.SetLoopTimeOffset(1.0f);
+        }
+
+        const float duration = track.GetDuration();
+        const float step = duration / static_cast<float>(kQueriesPerIteration);
+        float time = 0.0f;
+        for (auto _ : a_state) {
+            for (size_t i = 0; i < kQueriesPerIteration; ++i) {
+                benchmark::DoNotOptimize(track.GetPointAtTime(time));
+                time += step;
+                if (time > duration) {
+                    time -= duration;
+                }
+            }
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * kQueriesPerIteration));
+        a_state.SetLabel(ModeLabel(mode, loop, shape));
+    }
+
+    // Random access: scrubbing, seeks and offset tracks defeat the segment cursor
+    template <typename Track, auto MakePoint>
+    void BM_GetPointAtTimeRandom(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const auto mode = static_cast<FCFW::InterpolationMode>(a_state.range(1));
+
+        Track track;
+        FillTrack(track, FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount), mode, MakePoint);
+
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> timeDistribution(0.0f, track.GetDuration());
+        std::vector<float> times(kQueriesPerIteration);
+        for (float& time : times) {
+            time = timeDistribution(random);
+        }
+        for (auto _ : a_state) {
+            for (float time : times) {
+                benchmark::DoNotOptimize(track.GetPointAtTime(time));
+            }
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * kQueriesPerIteration));
+        a_state.SetLabel(ModeLabel(mode, false, SyntheticShape::kRandomWalk));
+    }
+
+    void PlaybackArguments(benchmark::internal::Benchmark* a_benchmark) {
+        a_benchmark->ArgNames({ "keys", "mode", "loop", "shape" });
+        for (size_t keys = kMinKeys; keys <= kMaxKeys; keys *= 10) {
+            for (auto mode : { FCFW::InterpolationMode::kNone, FCFW::InterpolationMode::kLinear, FCFW::InterpolationMode::kCubicHermite }) {
+                for (int loop : { 0, 1 }) {
+                    for (auto shape : { SyntheticShape::kOrbit, SyntheticShape::kRandomWalk, SyntheticShape::kRecorded }) {
+                        a_benchmark->Args({ static_cast<int64_t>(keys), static_cast<int64_t>(mode), loop, static_cast<int64_t>(shape) });
+                    }
+                }
+            }
+        }
+    }
+
+    void RandomAccessArguments(benchmark::internal::Benchmark* a_benchmark) {
+        a_benchmark->ArgNames({ "keys", "mode" });
+        for (size_t keys = kMinKeys; keys <= kMaxKeys; keys *= 10) {
+            for (auto mode : { FCFW::InterpolationMode::kLinear, FCFW::InterpolationMode::kCubicHermite }) {
+                a_benchmark->Args({ static_cast<int64_t>(keys), static_cast<int64_t>(mode) });
+            }
+        }
+    }
+
+    constexpr auto kTranslationPoint = &FCFW::Headless::MakeTranslationPoint;
+    constexpr auto kRotationPoint = &FCFW::Headless::MakeRotationPoint;
+    constexpr auto kFOVPoint = &FCFW::Headless::MakeFOVPoint;
+
+    BENCHMARK(BM_GetPointAtTime<FCFW::TranslationTrack, kTranslationPoint>)->Apply(PlaybackArguments);
+    BENCHMARK(BM_GetPointAtTime<FCFW::RotationTrack, kRotationPoint>)->Apply(PlaybackArguments);
+    BENCHMARK(BM_GetPointAtTime<FCFW::FOVTrack, kFOVPoint>)->Apply(PlaybackArguments);
+    BENCHMARK(BM_GetPointAtTimeRandom<FCFW::TranslationTrack, kTranslationPoint>)->Apply(RandomAccessArguments);
+    BENCHMARK(BM_GetPointAtTimeRandom<FCFW::RotationTrack, kRotationPoint>)->Apply(RandomAccessArguments);
+
+    // Key storage layout on long tracks, random times: the segment search and the reads of one cubic segment's
+    // times and four control values. layout:0 is the CameraPath columns; layout:1 a vector of point objects sorted
+    // by time, the layout CameraPath used before the columns, where each read pulls in a whole point.
+    void BM_LongTrackLookup(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const bool pointObjects = a_state.range(1) != 0;
+        const auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount);
+        std::vector<FCFW::TranslationPoint> points;
+        points.reserve(keyCount);
+        for (const auto& key : keys) {
+            points.push_back(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+        }
+        FCFW::TranslationPath path;
+        if (!pointObjects) {
+            path.AddPoints(points);
+            points = {};
+        }
+
+        std::mt19937 random(7);
+        std::uniform_real_distribution<float> timeDistribution(0.0f, keys.back().m_time);
+        std::vector<float> times(kQueriesPerIteration);
+        for (float& time : times) {
+            time = timeDistribution(random);
+        }
+
+        auto interpolate = [keyCount](size_t a_index, float a_time, auto a_time_of, auto a_value_of) {
+            const size_t current = std::clamp<size_t>(a_index, 1, keyCount - 1);
+            const float startTime = a_time_of(current - 1);
+            const float progress = (a_time - startTime) / (a_time_of(current) - startTime);
+            return FCFW::TranslationPoint::InterpolateCubic(a_value_of(current >= 2 ? current - 2 : 0), a_value_of(current - 1), a_value_of(current),
+                                                            a_value_of(std::min(current + 1, keyCount - 1)), progress);
+        };
+        for (auto _ : a_state) {
+            for (float time : times) {
+                if (pointObjects) {
+                    const auto it = std::lower_bound(points.begin(), points.end(), time,
+                                                     [](const FCFW::TranslationPoint& a_point, float a_time) { return a_point.m_transition.m_time < a_time; });
+                    benchmark::DoNotOptimize(interpolate(
+                        static_cast<size_t>(it - points.begin()), time, [&](size_t i) { return points[i].m_transition.m_time; }, [&](size_t i) { return points[i].m_point; }));
+                } else {
+                    benchmark::DoNotOptimize(interpolate(
+                        path.FindSegmentIndex(time), time, [&](size_t i) { return path.GetPointTime(i); }, [&](size_t i) { return path.GetPointValue(i); }));
+                }
+            }
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * kQueriesPerIteration));
+        a_state.SetLabel(pointObjects ? "pointObjects" : "columns");
+    }
+    BENCHMARK(BM_LongTrackLookup)->ArgNames({ "keys", "layout" })->ArgsProduct({ { 1000, 100000, 1000000 }, { 0, 1 } });
+
+    // Interpolation kernels. There is no separate angular Hermite: rotation segments evaluate Catmull-Rom Hermite
+    // polynomials on quaternion components, so that is measured next to the scalar Hermite and the 8-lane evaluator.
+    void BM_CubicHermiteInterpolate(benchmark::State& a_state) {
+        float t = 0.0f;
+        for (auto _ : a_state) {
+            benchmark::DoNotOptimize(FCFW::CubicHermiteInterpolate(0.0f, 1.0f, 3.0f, 2.0f, t));
+            t = t < 1.0f ? t + 0.001f : 0.0f;
+        }
+        a_state.SetItemsProcessed(a_state.iterations());
+    }
+    BENCHMARK(BM_CubicHermiteInterpolate);
+
+    void BM_QuaternionHermite(benchmark::State& a_state) {
+        const auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, 64);
+        std::vector<FCFW::Quaternion> quaternions;
+        for (const auto& key : keys) {
+            quaternions.push_back(FCFW::EulerToQuaternion(key.m_rotation));
+        }
+        size_t index = 0;
+        float t = 0.0f;
+        for (auto _ : a_state) {
+            const auto coefficients = FCFW::ComputeQuaternionHermiteCoefficients(quaternions[index], quaternions[index + 1], quaternions[index + 2], quaternions[index + 3]);
+            const FCFW::Quaternion q{ coefficients[0].Evaluate(t), coefficients[1].Evaluate(t), coefficients[2].Evaluate(t), coefficients[3].Evaluate(t) };
+            benchmark::DoNotOptimize(FCFW::QuaternionToEuler(q));
+            index = index + 4 < quaternions.size() ? index + 1 : 0;
+            t = t < 1.0f ? t + 0.01f : 0.0f;
+        }
+        a_state.SetItemsProcessed(a_state.iterations());
+    }
+    BENCHMARK(BM_QuaternionHermite);
+
+    void BM_EvaluateCubicLanes(benchmark::State& a_state) {
+        FCFW::CubicLanes lanes;
+        for (size_t lane = 0; lane < FCFW::CubicLanes::kLaneCount; ++lane) {
+            lanes.SetLane(lane, FCFW::ComputeCubicHermiteCoefficients(0.0f, static_cast<float>(lane), 2.0f, 1.0f));
+        }
+        alignas(32) float out[FCFW::CubicLanes::kLaneCount];
+        float t = 0.0f;
+        for (auto _ : a_state) {
+            FCFW::EvaluateCubicLanes(lanes, t, out);
+            benchmark::DoNotOptimize(out);
+            t = t < 1.0f ? t + 0.001f : 0.0f;
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * FCFW::CubicLanes::kLaneCount));
+    }
+    BENCHMARK(BM_EvaluateCubicLanes);
+
+    // Rotation segments against reference curves. Counters are the angle between the kernel's orientation and the
+    // reference in degrees (mean and max over 16 samples per segment): linear mode against exact slerp, cubic mode
+    // against SQUAD. kernel:0 is the quaternion kernel RotationPoint uses, from cached coefficients; kernel:1 the
+    // per-axis kernel it replaced (angle lerp with wrapping, sin/cos Hermite per axis), kept here for comparison.
+    struct ReferenceQuaternion {
+        double w = 1.0, x = 0.0, y = 0.0, z = 0.0;
+
+        static ReferenceQuaternion FromEuler(const RE::NiPoint3& a_euler) {
+            const auto q = FCFW::EulerToQuaternion(a_euler);
+            return ReferenceQuaternion{ q.w, q.x, q.y, q.z }.Normalized();
+        }
+
+        double Dot(const ReferenceQuaternion& a_other) const { return w * a_other.w + x * a_other.x + y * a_other.y + z * a_other.z; }
+        ReferenceQuaternion operator-() const { return { -w, -x, -y, -z }; }
+        ReferenceQuaternion Conjugate() const { return { w, -x, -y, -z }; }
+        ReferenceQuaternion operator*(const ReferenceQuaternion& b) const {
+            return { w * b.w - x * b.x - y * b.y - z * b.z, w * b.x + x * b.w + y * b.z - z * b.y,
+                     w * b.y - x * b.z + y * b.w + z * b.x, w * b.z + x * b.y - y * b.x + z * b.w };
+        }
+        ReferenceQuaternion Normalized() const {
+            const double length = std::sqrt(Dot(*this));
+            return { w / length, x / length, y / length, z / length };
+        }
+
+        // Unit quaternion logarithm and exponential of a pure quaternion (w = 0)
+        ReferenceQuaternion Log() const {
+            const double vectorLength = std::sqrt(x * x + y * y + z * z);
+            const double scale = vectorLength > 1e-12 ? std::atan2(vectorLength, w) / vectorLength : 1.0;
+            return { 0.0, x * scale, y * scale, z * scale };
+        }
+        ReferenceQuaternion Exp() const {
+            const double angle = std::sqrt(x * x + y * y + z * z);
+            const double scale = angle > 1e-12 ? std::sin(angle) / angle : 1.0;
+            return { std::cos(angle), x * scale, y * scale, z * scale };
+        }
+
+        static ReferenceQuaternion Slerp(const ReferenceQuaternion& a, ReferenceQuaternion b, double t) {
+            if (a.Dot(b) < 0.0) {
+                b = -b;
+            }
+            const double theta = std::acos(std::clamp(a.Dot(b), -1.0, 1.0));
+            if (theta < 1e-9) {
+                return a;
+            }
+            const double wa = std::sin((1.0 - t) * theta) / std::sin(theta);
+            const double wb = std::sin(t * theta) / std::sin(theta);
+            return ReferenceQuaternion{ wa * a.w + wb * b.w, wa * a.x + wb * b.x, wa * a.y + wb * b.y, wa * a.z + wb * b.z }.Normalized();
+        }
+
+        // Inner control point of SQUAD at a_current
+        static ReferenceQuaternion SquadControl(const ReferenceQuaternion& a_previous, const ReferenceQuaternion& a_current, const ReferenceQuaternion& a_next) {
+            const ReferenceQuaternion inverse = a_current.Conjugate();
+            const ReferenceQuaternion toNext = (inverse * a_next).Log();
+            const ReferenceQuaternion toPrevious = (inverse * a_previous).Log();
+            const ReferenceQuaternion tangent{ 0.0, -(toNext.x + toPrevious.x) * 0.25, -(toNext.y + toPrevious.y) * 0.25, -(toNext.z + toPrevious.z) * 0.25 };
+            return (a_current * tangent.Exp()).Normalized();
+        }
+
+        // SQUAD between q1 and q2 with hemisphere-aligned neighbours, as ComputeQuaternionHermiteCoefficients aligns them
+        static ReferenceQuaternion Squad(const ReferenceQuaternion& q0, const ReferenceQuaternion& q1, const ReferenceQuaternion& q2, const ReferenceQuaternion& q3, double t) {
+            const ReferenceQuaternion a0 = q1.Dot(q0) < 0.0 ? -q0 : q0;
+            const ReferenceQuaternion a2 = q1.Dot(q2) < 0.0 ? -q2 : q2;
+            const ReferenceQuaternion a3 = a2.Dot(q3) < 0.0 ? -q3 : q3;
+            const ReferenceQuaternion s1 = SquadControl(a0, q1, a2);
+            const ReferenceQuaternion s2 = SquadControl(q1, a2, a3);
+            return Slerp(Slerp(q1, a2, t), Slerp(s1, s2, t), 2.0 * t * (1.0 - t));
+        }
+
+        static double AngleDegrees(const ReferenceQuaternion& a, const ReferenceQuaternion& b) {
+            return 2.0 * std::acos(std::min(1.0, std::abs(a.Dot(b)))) * 180.0 / std::numbers::pi;
+        }
+    };
+
+    // The per-axis rotation kernels replaced by quaternion interpolation, in their cached form
+    struct PerAxisRotationSegment {
+        std::array<FCFW::CubicCoefficients, 6> m_coefficients;  // sin/cos pairs for pitch, roll, yaw (cubic)
+        RE::NiPoint3 m_from;
+        RE::NiPoint3 m_delta;  // Wrapped angle deltas (linear)
+        bool m_isCubic = false;
+
+        PerAxisRotationSegment(const RE::NiPoint3& p0, const RE::NiPoint3& p1, const RE::NiPoint3& p2, const RE::NiPoint3& p3, bool a_cubic) :
+            m_from(p1), m_isCubic(a_cubic) {
+            m_delta = RE::NiPoint3{ _ts_SKSEFunctions::NormalRelativeAngle(p2.x - p1.x), _ts_SKSEFunctions::NormalRelativeAngle(p2.y - p1.y),
+                                    _ts_SKSEFunctions::NormalRelativeAngle(p2.z - p1.z) };
+            const float a0[3] = { p0.x, p0.y, p0.z };
+            const float a1[3] = { p1.x, p1.y, p1.z };
+            const float a2[3] = { p2.x, p2.y, p2.z };
+            const float a3[3] = { p3.x, p3.y, p3.z };
+            for (size_t axis = 0; axis < 3; ++axis) {
+                m_coefficients[axis * 2] = FCFW::ComputeCubicHermiteCoefficients(std::sin(a0[axis]), std::sin(a1[axis]), std::sin(a2[axis]), std::sin(a3[axis]));
+                m_coefficients[axis * 2 + 1] = FCFW::ComputeCubicHermiteCoefficients(std::cos(a0[axis]), std::cos(a1[axis]), std::cos(a2[axis]), std::cos(a3[axis]));
+            }
+        }
+
+        RE::NiPoint3 Evaluate(float t) const {
+            if (!m_isCubic) {
+                return RE::NiPoint3{ _ts_SKSEFunctions::NormalRelativeAngle(m_from.x + t * m_delta.x), _ts_SKSEFunctions::NormalRelativeAngle(m_from.y + t * m_delta.y),
+                                     _ts_SKSEFunctions::NormalRelativeAngle(m_from.z + t * m_delta.z) };
+            }
+            return RE::NiPoint3{ std::atan2(m_coefficients[0].Evaluate(t), m_coefficients[1].Evaluate(t)),
+                                 std::atan2(m_coefficients[2].Evaluate(t), m_coefficients[3].Evaluate(t)),
+                                 std::atan2(m_coefficients[4].Evaluate(t), m_coefficients[5].Evaluate(t)) };
+        }
+    };
+
+    constexpr size_t kSamplesPerSegment = 16;
+
+    template <typename Evaluate>
+    void RecordRotationError(benchmark::State& a_state, const std::vector<RE::NiPoint3>& a_keys, bool a_cubic, Evaluate a_evaluate) {
+        double sum = 0.0;
+        double max = 0.0;
+        size_t count = 0;
+        for (size_t segment = 0; segment + 1 < a_keys.size(); ++segment) {
+            const auto q0 = ReferenceQuaternion::FromEuler(a_keys[segment > 0 ? segment - 1 : 0]);
+            const auto q1 = ReferenceQuaternion::FromEuler(a_keys[segment]);
+            const auto q2 = ReferenceQuaternion::FromEuler(a_keys[segment + 1]);
+            const auto q3 = ReferenceQuaternion::FromEuler(a_keys[std::min(segment + 2, a_keys.size() - 1)]);
+            for (size_t sample = 0; sample <= kSamplesPerSegment; ++sample) {
+                const double t = static_cast<double>(sample) / kSamplesPerSegment;
+                const auto reference = a_cubic ? ReferenceQuaternion::Squad(q0, q1, q2, q3, t) : ReferenceQuaternion::Slerp(q1, q2, t);
+                const double error = ReferenceQuaternion::AngleDegrees(ReferenceQuaternion::FromEuler(a_evaluate(segment, static_cast<float>(t))), reference);
+                sum += error;
+                max = std::max(max, error);
+                ++count;
+            }
+        }
+        a_state.counters["mean_deg"] = sum / static_cast<double>(count);
+        a_state.counters["max_deg"] = max;
+    }
+
+    void BM_RotationSegmentKernel(benchmark::State& a_state) {
+        const bool perAxis = a_state.range(0) != 0;
+        const bool cubic = static_cast<FCFW::InterpolationMode>(a_state.range(1)) == FCFW::InterpolationMode::kCubicHermite;
+        const auto shape = static_cast<SyntheticShape>(a_state.range(2));
+        std::vector<RE::NiPoint3> keys;
+        for (const auto& key : FCFW::Headless::GenerateSyntheticKeys(shape, 64)) {
+            keys.push_back(key.m_rotation);
+        }
+
+        // Segment ending at keys[i + 1], end-mode clamping at the boundaries like GetHermiteControlIndices
+        std::vector<FCFW::RotationPoint::SegmentCoefficients> quaternionSegments;
+        std::vector<PerAxisRotationSegment> perAxisSegments;
+        for (size_t i = 0; i + 1 < keys.size(); ++i) {
+            const auto& p0 = keys[i > 0 ? i - 1 : 0];
+            const auto& p3 = keys[std::min(i + 2, keys.size() - 1)];
+            quaternionSegments.push_back(cubic ? FCFW::RotationPoint::ComputeSegmentCoefficients(p0, keys[i], keys[i + 1], p3) :
+                                                 FCFW::RotationPoint::ComputeLinearCoefficients(keys[i], keys[i + 1]));
+            perAxisSegments.emplace_back(p0, keys[i], keys[i + 1], p3, cubic);
+        }
+        auto evaluate = [&](size_t a_segment, float a_t) {
+            return perAxis ? perAxisSegments[a_segment].Evaluate(a_t) : FCFW::RotationPoint::EvaluateSegment(quaternionSegments[a_segment], a_t);
+        };
+        RecordRotationError(a_state, keys, cubic, evaluate);
+
+        const size_t segmentCount = quaternionSegments.size();
+        for (auto _ : a_state) {
+            for (size_t segment = 0; segment < segmentCount; ++segment) {
+                for (size_t sample = 0; sample < kSamplesPerSegment; ++sample) {
+                    benchmark::DoNotOptimize(evaluate(segment, static_cast<float>(sample) * (1.0f / kSamplesPerSegment)));
+                }
+            }
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * segmentCount * kSamplesPerSegment));
+        a_state.SetLabel(std::string(perAxis ? "perAxis/" : "quaternion/") + FCFW::InterpolationModeToString(static_cast<FCFW::InterpolationMode>(a_state.range(1))) + "/" +
+                         FCFW::Headless::SyntheticShapeName(shape));
+    }
+    BENCHMARK(BM_RotationSegmentKernel)
+        ->ArgNames({ "kernel", "mode", "shape" })
+        ->ArgsProduct({ { 0, 1 },
+                        { static_cast<int64_t>(FCFW::InterpolationMode::kLinear), static_cast<int64_t>(FCFW::InterpolationMode::kCubicHermite) },
+                        { static_cast<int64_t>(SyntheticShape::kOrbit), static_cast<int64_t>(SyntheticShape::kRandomWalk), static_cast<int64_t>(SyntheticShape::kRecorded) } });
+
+    // Linear mode's speed-corrected normalized lerp against exact slerp, by angle between the keys (degrees)
+    void BM_RotationSlerpError(benchmark::State& a_state) {
+        const float separation = static_cast<float>(a_state.range(0)) * PI / 180.0f;
+        std::vector<RE::NiPoint3> keys;
+        std::mt19937 random(5);
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        for (size_t i = 0; i < 64; ++i) {
+            // A start orientation and one a_separation away about a random axis, as Euler angles
+            const RE::NiPoint3 start{ 0.6f * unit(random), 0.3f * unit(random), PI * unit(random) };
+            RE::NiPoint3 axis{ unit(random), unit(random), unit(random) };
+            axis.Unitize();
+            const auto q = ReferenceQuaternion::FromEuler(start);
+            const ReferenceQuaternion turn{ std::cos(separation * 0.5), axis.x * std::sin(separation * 0.5), axis.y * std::sin(separation * 0.5), axis.z * std::sin(separation * 0.5) };
+            const auto end = q * turn;
+            keys.push_back(start);
+            keys.push_back(FCFW::QuaternionToEuler(FCFW::Quaternion{ static_cast<float>(end.w), static_cast<float>(end.x), static_cast<float>(end.y), static_cast<float>(end.z) }));
+        }
+
+        // Each pair (keys[2i], keys[2i + 1]) is one segment
+        std::vector<FCFW::RotationPoint::SegmentCoefficients> segments;
+        double sum = 0.0;
+        double max = 0.0;
+        size_t count = 0;
+        for (size_t i = 0; i + 1 < keys.size(); i += 2) {
+            segments.push_back(FCFW::RotationPoint::ComputeLinearCoefficients(keys[i], keys[i + 1]));
+            const auto q1 = ReferenceQuaternion::FromEuler(keys[i]);
+            const auto q2 = ReferenceQuaternion::FromEuler(keys[i + 1]);
+            for (size_t sample = 0; sample <= kSamplesPerSegment; ++sample) {
+                const double t = static_cast<double>(sample) / kSamplesPerSegment;
+                const auto value = FCFW::RotationPoint::EvaluateSegment(segments.back(), static_cast<float>(t));
+                const double error = ReferenceQuaternion::AngleDegrees(ReferenceQuaternion::FromEuler(value), ReferenceQuaternion::Slerp(q1, q2, t));
+                sum += error;
+                max = std::max(max, error);
+                ++count;
+            }
+        }
+        a_state.counters["mean_deg"] = sum / static_cast<double>(count);
+        a_state.counters["max_deg"] = max;
+
+        for (auto _ : a_state) {
+            for (const auto& segment : segments) {
+                for (size_t sample = 0; sample < kSamplesPerSegment; ++sample) {
+                    benchmark::DoNotOptimize(FCFW::RotationPoint::EvaluateSegment(segment, static_cast<float>(sample) * (1.0f / kSamplesPerSegment)));
+                }
+            }
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * segments.size() * kSamplesPerSegment));
+    }
+    BENCHMARK(BM_RotationSlerpError)->ArgName("separation")->Arg(10)->Arg(45)->Arg(90)->Arg(135)->Arg(179);
+
+    // Sorted insertion: in time order (recording) and in random order (editing, file import of unsorted keys)
+    void BM_AddPoint(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const bool shuffled = a_state.range(1) != 0;
+        auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount);
+        if (shuffled) {
+            std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+        }
+        for (auto _ : a_state) {
+            FCFW::TranslationPath path;
+            for (const auto& key : keys) {
+                path.AddPoint(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            }
+            benchmark::DoNotOptimize(path.GetPointCount());
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount));
+    }
+    BENCHMARK(BM_AddPoint)->ArgNames({ "keys", "shuffled" })->ArgsProduct({ { 10, 100, 1000, 10000 }, { 0, 1 } });
+
+    // Recording throughput: one translation and one rotation key per frame through the Timeline API
+    void BM_RecordKeys(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRecorded, keyCount);
+        for (auto _ : a_state) {
+            FCFW::Timeline timeline;
+            for (const auto& key : keys) {
+                timeline.AddTranslationPoint(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+                timeline.AddRotationPoint(FCFW::Headless::MakeRotationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            }
+            benchmark::DoNotOptimize(timeline.GetTranslationPointCount());
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount));
+    }
+    BENCHMARK(BM_RecordKeys)->ArgName("keys")->RangeMultiplier(10)->Range(100, 100000);
+
+    // Procedural path with keys in random order. Per key: one Timeline::AddTranslationPoint each, as IVFCFW1 callers
+    // do. Builder: the ITimelineBuilder commit (IVFCFW3), one sorted AddPoints into a fresh track and a SwapPoints.
+    void BM_BuildTimelinePerKey(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+        for (auto _ : a_state) {
+            FCFW::Timeline timeline;
+            for (const auto& key : keys) {
+                timeline.AddTranslationPoint(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            }
+            benchmark::DoNotOptimize(timeline.GetTranslationPointCount());
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount));
+    }
+    BENCHMARK(BM_BuildTimelinePerKey)->ArgName("keys")->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMicrosecond);
+
+    void BM_BuildTimelineBuilder(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+        for (auto _ : a_state) {
+            std::vector<FCFW::TranslationPoint> points;
+            points.reserve(keys.size());
+            for (const auto& key : keys) {
+                points.push_back(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            }
+            FCFW::TranslationTrack translationTrack;
+            FCFW::RotationTrack rotationTrack;
+            FCFW::FOVTrack fovTrack;
+            translationTrack.AddPoints(points);
+
+            FCFW::Timeline timeline;
+            timeline.SwapPoints(translationTrack, rotationTrack, fovTrack);
+            benchmark::DoNotOptimize(timeline.GetTranslationPointCount());
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount));
+    }
+    BENCHMARK(BM_BuildTimelineBuilder)->ArgName("keys")->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+
+    // Builder commit into a playing timeline, end to end: TimelineBuilder::Commit's AddPoints, SwapTimelinePoints and
+    // PublishEdit, then the frame adopting the version in PlayTimeline (TimelineManager is not in the headless build).
+    // locked_us is the part run under the timeline's locks: the swap, plus the version copy with copy_under_lock=1.
+    void BM_CommitPlayingTimeline(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const bool copyUnderLock = a_state.range(1) != 0;
+        auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount);
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(3));
+
+        FCFW::Timeline timeline;
+        {
+            FCFW::TranslationTrack translationTrack;
+            FCFW::RotationTrack rotationTrack;
+            FCFW::FOVTrack fovTrack;
+            FillTrack(translationTrack, keys, FCFW::InterpolationMode::kCubicHermite, FCFW::Headless::MakeTranslationPoint);
+            FillTrack(rotationTrack, keys, FCFW::InterpolationMode::kCubicHermite, FCFW::Headless::MakeRotationPoint);
+            timeline.SwapPoints(translationTrack, rotationTrack, fovTrack);
+        }
+        timeline.StartPlayback();
+        auto playing = std::make_shared<FCFW::Timeline>(timeline);
+        FCFW::TimelineVersionSlot slot;
+        std::chrono::steady_clock::duration locked{};
+
+        for (auto _ : a_state) {
+            std::vector<FCFW::TranslationPoint> translationPoints;
+            std::vector<FCFW::RotationPoint> rotationPoints;
+            translationPoints.reserve(keys.size());
+            rotationPoints.reserve(keys.size());
+            for (const auto& key : keys) {
+                translationPoints.push_back(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+                rotationPoints.push_back(FCFW::Headless::MakeRotationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            }
+            FCFW::TranslationTrack translationTrack;
+            FCFW::RotationTrack rotationTrack;
+            FCFW::FOVTrack fovTrack;
+            translationTrack.AddPoints(translationPoints);
+            rotationTrack.AddPoints(rotationPoints);
+
+            std::shared_ptr<FCFW::Timeline> version;
+            if (copyUnderLock) {
+                const auto lockedStart = std::chrono::steady_clock::now();
+                timeline.SwapPoints(translationTrack, rotationTrack, fovTrack);
+                version = std::make_shared<FCFW::Timeline>(timeline);
+                locked += std::chrono::steady_clock::now() - lockedStart;
+            } else {
+                FCFW::TranslationTrack versionTranslation = translationTrack;
+                FCFW::RotationTrack versionRotation = rotationTrack;
+                FCFW::FOVTrack versionFOV = fovTrack;
+                const auto lockedStart = std::chrono::steady_clock::now();
+                timeline.SwapPoints(translationTrack, rotationTrack, fovTrack);
+                version = timeline.CopyWithPoints(std::move(versionTranslation), std::move(versionRotation), std::move(versionFOV));
+                locked += std::chrono::steady_clock::now() - lockedStart;
+            }
+            version->PrepareForPlayback();
+            slot.Publish(std::move(version));
+
+            if (auto next = slot.Take()) {
+                next->ContinuePlayback(*playing);
+                std::swap(playing, next);
+                slot.Retire(std::move(next));
+            }
+            playing->UpdatePlayback(1.0f / 60.0f);
+            benchmark::DoNotOptimize(playing->GetTranslation(playing->GetPlaybackTime()));
+        }
+        a_state.counters["locked_us"] = benchmark::Counter(std::chrono::duration<double, std::micro>(locked).count(), benchmark::Counter::kAvgIterations);
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount));
+    }
+    BENCHMARK(BM_CommitPlayingTimeline)->ArgNames({ "keys", "copy_under_lock" })->ArgsProduct({ { 100, 1000, 10000, 100000 }, { 0, 1 } })->Unit(benchmark::kMicrosecond);
+
+    // YAML round trip through ExportPathToYAML / ImportPathFromYAML (translation and rotation sections of one file)
+    std::filesystem::path WriteTimelineFile(size_t a_keyCount) {
+        const auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, a_keyCount);
+        FCFW::TranslationPath translation;
+        FCFW::RotationPath rotation;
+        for (const auto& key : keys) {
+            translation.AddPoint(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            rotation.AddPoint(FCFW::Headless::MakeRotationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+        }
+        const auto filePath = std::filesystem::temp_directory_path() / ("fcfw_bench_" + std::to_string(a_keyCount) + ".yaml");
+        std::ofstream file(filePath);
+        translation.ExportPath(file);
+        file << "\n";  // Separate the sections, as TimelineManager::ExportTimeline does
+        rotation.ExportPath(file);
+        return filePath;
+    }
+
+    void BM_ExportPath(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const auto keys = FCFW::Headless::GenerateSyntheticKeys(SyntheticShape::kRandomWalk, keyCount);
+        FCFW::TranslationPath translation;
+        FCFW::RotationPath rotation;
+        for (const auto& key : keys) {
+            translation.AddPoint(FCFW::Headless::MakeTranslationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+            rotation.AddPoint(FCFW::Headless::MakeRotationPoint(key, FCFW::InterpolationMode::kCubicHermite));
+        }
+        const auto filePath = std::filesystem::temp_directory_path() / "fcfw_bench_export.yaml";
+        for (auto _ : a_state) {
+            std::ofstream file(filePath, std::ios::trunc);
+            translation.ExportPath(file);
+            file << "\n";
+            rotation.ExportPath(file);
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount * 2));
+        a_state.SetBytesProcessed(static_cast<int64_t>(a_state.iterations() * std::filesystem::file_size(filePath)));
+        std::filesystem::remove(filePath);
+    }
+    BENCHMARK(BM_ExportPath)->ArgName("keys")->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+    void BM_ImportPath(benchmark::State& a_state) {
+        const auto keyCount = static_cast<size_t>(a_state.range(0));
+        const auto filePath = WriteTimelineFile(keyCount);
+        const std::string filePathString = filePath.string();
+        for (auto _ : a_state) {
+            FCFW::TranslationPath translation;
+            FCFW::RotationPath rotation;
+            translation.AddPathFromFile(filePathString);
+            rotation.AddPathFromFile(filePathString);
+            benchmark::DoNotOptimize(translation.GetPointCount() + rotation.GetPointCount());
+        }
+        a_state.SetItemsProcessed(static_cast<int64_t>(a_state.iterations() * keyCount * 2));
+        a_state.SetBytesProcessed(static_cast<int64_t>(a_state.iterations() * std::filesystem::file_size(filePath)));
+        std::filesystem::remove(filePath);
+    }
+    BENCHMARK(BM_ImportPath)->ArgName("keys")->RangeMultiplier(10)->Range(10, 10000)->Unit(benchmark::kMicrosecond);
+
+    // Per-event cost of the input hooks' "is a timeline playing and blocking input" check.
+    // Before: GetActiveTimelineID, then IsPlaybackRunning and IsUserRotationAllowed, each locking the manager's
+    // recursive_mutex and looking the timeline up in its map. After: one load of the PlaybackStateWord.
+    struct LockedHookState {
+        struct State {
+            bool m_isPlaybackRunning = false;
+            bool m_allowUserRotation = false;
+        };
+
+        bool IsPlaybackRunning(size_t a_timelineID) const {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            auto it = m_timelines.find(a_timelineID);
+            return it != m_timelines.end() && it->second.m_isPlaybackRunning;
+        }
+
+        bool IsUserRotationAllowed(size_t a_timelineID) const {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            auto it = m_timelines.find(a_timelineID);
+            return it != m_timelines.end() && it->second.m_allowUserRotation;
+        }
+
+        mutable std::recursive_mutex m_mutex;
+        std::unordered_map<size_t, State> m_timelines;
+        size_t m_activeTimelineID = 0;
+    };
+
+    // One manager per timeline count, built by whichever benchmark thread gets there first
+    const LockedHookState& GetLockedHookState(size_t a_timelineCount) {
+        static std::mutex setupMutex;
+        static std::unordered_map<size_t, LockedHookState> hookStates;
+        std::lock_guard<std::mutex> lock(setupMutex);
+        auto [it, inserted] = hookStates.try_emplace(a_timelineCount);
+        if (inserted) {
+            for (size_t id = 1; id <= a_timelineCount; ++id) {
+                it->second.m_timelines[id] = LockedHookState::State{ id == 1, false };
+            }
+            it->second.m_activeTimelineID = 1;
+        }
+        return it->second;
+    }
+
+    void BM_HookStateLocked(benchmark::State& a_state) {
+        const LockedHookState& hookState = GetLockedHookState(static_cast<size_t>(a_state.range(0)));
+        for (auto _ : a_state) {
+            const size_t activeID = hookState.m_activeTimelineID;
+            const bool blockInput = activeID != 0 && hookState.IsPlaybackRunning(activeID) && !hookState.IsUserRotationAllowed(activeID);
+            benchmark::DoNotOptimize(blockInput);
+        }
+        a_state.SetItemsProcessed(a_state.iterations());
+    }
+    BENCHMARK(BM_HookStateLocked)->ArgName("timelines")->Arg(1)->Arg(16)->ThreadRange(1, 4);
+
+    void BM_HookStateSnapshot(benchmark::State& a_state) {
+        static FCFW::PlaybackStateWord hookState;
+        static std::once_flag setup;
+        std::call_once(setup, [] { hookState.Publish(FCFW::PlaybackSnapshot{ 1, true, false, false }); });
+        for (auto _ : a_state) {
+            const FCFW::PlaybackSnapshot playback = hookState.Load();
+            const bool blockInput = playback.m_isPlaybackRunning && !playback.m_allowUserRotation;
+            benchmark::DoNotOptimize(blockInput);
+        }
+        a_state.SetItemsProcessed(a_state.iterations());
+    }
+    BENCHMARK(BM_HookStateSnapshot)->ThreadRange(1, 4);
+
+    // Per-call cost of the mod name lookup every Papyrus native makes, with a 250-plugin load order; the argument is the
+    // mod's position in the load order. Before: ModNameToHandle walked TESDataHandler::files and built a std::string
+    // of every file name up to the match. After: a PluginHandleCache hit on the pooled BSFixedString pointer.
+    constexpr size_t kStandInPluginCount = 250;
+
+    const std::vector<std::string>& GetStandInLoadOrder() {
+        static const std::vector<std::string> fileNames = [] {
+            std::vector<std::string> names;
+            for (size_t i = 0; i < kStandInPluginCount; ++i) {
+                names.push_back("StandInPlugin_" + std::to_string(i) + ".esp");
+            }
+            return names;
+        }();
+        return fileNames;
+    }
+
+    void BM_ModNameToHandleScan(benchmark::State& a_state) {
+        const auto& fileNames = GetStandInLoadOrder();
+        const char* modName = fileNames[static_cast<size_t>(a_state.range(0))].c_str();
+        for (auto _ : a_state) {
+            SKSE::PluginHandle handle = 0;
+            for (size_t i = 0; i < fileNames.size(); ++i) {
+                if (std::string(fileNames[i].c_str()) == modName) {
+                    handle = static_cast<SKSE::PluginHandle>(i);
+                    break;
+                }
+            }
+            benchmark::DoNotOptimize(handle);
+        }
+        a_state.SetItemsProcessed(a_state.iterations());
+    }
+    BENCHMARK(BM_ModNameToHandleScan)->ArgName("position")->Arg(0)->Arg(125)->Arg(249);
+
+    void BM_ModNameToHandleCached(benchmark::State& a_state) {
+        const auto& fileNames = GetStandInLoadOrder();
+        std::vector<FCFW::PluginHandleCache::LoadOrderFile> files;
+        for (size_t i = 0; i < fileNames.size(); ++i) {
+            files.push_back({ fileNames[i], static_cast<std::uint32_t>(i) });
+        }
+        FCFW::PluginHandleCache cache;
+        cache.Rebuild(files, files.size());
+
+        const std::string internedName = fileNames[static_cast<size_t>(a_state.range(0))];  // Stands in for the pooled string
+        for (auto _ : a_state) {
+            benchmark::DoNotOptimize(cache.IsCurrent(files.size()));
+            benchmark::DoNotOptimize(cache.Find(internedName.c_str()));
+        }
+        a_state.SetItemsProcessed(a_state.iterations());
+    }
+    BENCHMARK(BM_ModNameToHandleCached)->ArgName("position")->Arg(0)->Arg(125)->Arg(249);
+}
+
+int main(int argc, char** argv) {
+    // Imports log per file; keep the benchmark output clean
+    spdlog::set_level(spdlog::level::warn);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
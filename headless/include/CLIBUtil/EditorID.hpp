@@ -0,0 +1,8 @@
+#pragma once
+
+// Headless stand-in for CLibUtil's editor ID lookup
+namespace clib_util::editorID {
+    inline std::string get_editorID(const RE::TESForm* a_form) {
+        return a_form ? std::string(a_form->GetFormEditorID()) : std::string();
+    }
+}
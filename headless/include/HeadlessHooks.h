@@ -0,0 +1,9 @@
+#pragma once
+
+// Headless stand-in for the Hooks.h accessors the timeline engine reads (see CameraPath.h)
+namespace Hooks {
+    class FreeCameraRollHook {
+    public:
+        static float GetFreeCameraRoll();  // StandInWorld camera roll
+    };
+}
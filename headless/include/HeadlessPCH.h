@@ -0,0 +1,32 @@
+#pragma once
+
+// Precompiled header of the headless core (replaces include/PCH.h): the standard library, spdlog and the
+// stand-in game types of StandInGame.h
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include "StandInGame.h"
+
+using namespace SKSE;
+using namespace SKSE::log;
+using namespace std::literals;
@@ -0,0 +1,185 @@
+#pragma once
+
+// Stand-ins for the CommonLibSSE / SKSE types the timeline engine uses, so the core builds without the game.
+// Only the members the core touches exist; forms and references are owned and moved by StandInWorld.
+
+namespace RE {
+    using FormID = std::uint32_t;
+
+    class NiPoint3 {
+    public:
+        NiPoint3() = default;
+        NiPoint3(float a_x, float a_y, float a_z) : x(a_x), y(a_y), z(a_z) {}
+
+        NiPoint3 operator+(const NiPoint3& a_rhs) const { return NiPoint3(x + a_rhs.x, y + a_rhs.y, z + a_rhs.z); }
+        NiPoint3 operator-(const NiPoint3& a_rhs) const { return NiPoint3(x - a_rhs.x, y - a_rhs.y, z - a_rhs.z); }
+        NiPoint3 operator*(float a_scalar) const { return NiPoint3(x * a_scalar, y * a_scalar, z * a_scalar); }
+        NiPoint3 operator/(float a_scalar) const { return NiPoint3(x / a_scalar, y / a_scalar, z / a_scalar); }
+        NiPoint3 operator-() const { return NiPoint3(-x, -y, -z); }
+        NiPoint3& operator+=(const NiPoint3& a_rhs) { x += a_rhs.x; y += a_rhs.y; z += a_rhs.z; return *this; }
+        NiPoint3& operator-=(const NiPoint3& a_rhs) { x -= a_rhs.x; y -= a_rhs.y; z -= a_rhs.z; return *this; }
+        NiPoint3& operator*=(float a_scalar) { x *= a_scalar; y *= a_scalar; z *= a_scalar; return *this; }
+        bool operator==(const NiPoint3& a_rhs) const { return x == a_rhs.x && y == a_rhs.y && z == a_rhs.z; }
+
+        float Dot(const NiPoint3& a_rhs) const { return x * a_rhs.x + y * a_rhs.y + z * a_rhs.z; }
+        NiPoint3 Cross(const NiPoint3& a_rhs) const { return NiPoint3(y * a_rhs.z - z * a_rhs.y, z * a_rhs.x - x * a_rhs.z, x * a_rhs.y - y * a_rhs.x); }
+        float Length() const { return std::sqrt(x * x + y * y + z * z); }
+        float SqrLength() const { return x * x + y * y + z * z; }
+        float Unitize() {
+            const float length = Length();
+            if (length > 0.0f) {
+                *this = *this / length;
+            }
+            return length;
+        }
+
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+    };
+
+    struct NiMatrix3 {
+        float entry[3][3] = { { 1.0f, 0.0f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+    };
+
+    struct NiTransform {
+        NiMatrix3 rotate;
+        NiPoint3 translate;
+        float scale = 1.0f;
+    };
+
+    class NiAVObject {
+    public:
+        NiTransform local;
+        NiTransform world;
+    };
+
+    // Non-owning: stand-in nodes live as long as their StandInWorld reference
+    template <class T>
+    class NiPointer {
+    public:
+        NiPointer() = default;
+        void reset(T* a_object = nullptr) { m_object = a_object; }
+        T* get() const { return m_object; }
+        T* operator->() const { return m_object; }
+        explicit operator bool() const { return m_object != nullptr; }
+
+    private:
+        T* m_object = nullptr;
+    };
+
+    struct TESFile {
+        char fileName[260] = {};
+    };
+
+    class TESForm {
+    public:
+        virtual ~TESForm() = default;
+
+        FormID GetFormID() const { return formID; }
+        const char* GetFormEditorID() const { return editorID.c_str(); }
+        TESFile* GetFile(std::int32_t = -1) const { return file; }
+
+        template <class T>
+        T* As() { return dynamic_cast<T*>(this); }
+        template <class T>
+        const T* As() const { return dynamic_cast<const T*>(this); }
+
+        // Registry lookups, answered by StandInWorld
+        static TESForm* LookupByID(FormID a_formID);
+        static TESForm* LookupByEditorIDImpl(std::string_view a_editorID);
+        template <class T>
+        static T* LookupByEditorID(std::string_view a_editorID) {
+            TESForm* form = LookupByEditorIDImpl(a_editorID);
+            return form ? form->As<T>() : nullptr;
+        }
+
+        FormID formID = 0;
+        std::string editorID;
+        TESFile* file = nullptr;
+    };
+
+    class TESObjectREFR : public TESForm {
+    public:
+        bool Is3DLoaded() const { return is3DLoaded; }
+        NiAVObject* Get3D() const { return is3DLoaded ? root : nullptr; }
+        NiPoint3 GetPosition() const { return position; }
+        float GetAngleX() const { return angle.x; }
+        float GetAngleY() const { return angle.y; }
+        float GetAngleZ() const { return angle.z; }
+
+        NiPoint3 position;
+        NiPoint3 angle;  // pitch=x, roll=y, yaw=z
+        NiAVObject* root = nullptr;
+        bool is3DLoaded = true;
+    };
+
+    class Actor : public TESObjectREFR {
+    public:
+        float GetHeading(bool) const { return angle.z; }
+    };
+
+    // Camera state at playback start lives in StandInWorld; only the FOV is read through the singleton
+    class PlayerCamera {
+    public:
+        static PlayerCamera* GetSingleton() {
+            static PlayerCamera singleton;
+            return &singleton;
+        }
+
+        float worldFOV = 80.0f;
+    };
+
+    struct BGSBodyPartDefs {
+        enum class LIMB_ENUM : std::int32_t {
+            kNone = -1,
+            kTorso = 0,
+            kHead = 1
+        };
+    };
+
+    enum class BSEventNotifyControl {
+        kContinue = 0,
+        kStop = 1
+    };
+
+    template <class Event>
+    class BSTEventSource {};
+
+    template <class Event>
+    class BSTEventSink {
+    public:
+        virtual ~BSTEventSink() = default;
+        virtual BSEventNotifyControl ProcessEvent(const Event* a_event, BSTEventSource<Event>* a_eventSource) = 0;
+    };
+
+    struct TESObjectLoadedEvent {
+        FormID formID = 0;
+        bool loaded = false;
+    };
+
+    // No load events in the headless core: sinks are accepted and never called
+    class ScriptEventSourceHolder {
+    public:
+        static ScriptEventSourceHolder* GetSingleton() {
+            static ScriptEventSourceHolder singleton;
+            return &singleton;
+        }
+
+        template <class Event>
+        void AddEventSink(BSTEventSink<Event>*) {}
+    };
+}
+
+namespace SKSE {
+    using PluginHandle = std::uint32_t;
+
+    namespace log {
+        using spdlog::critical;
+        using spdlog::debug;
+        using spdlog::error;
+        using spdlog::info;
+        using spdlog::trace;
+        using spdlog::warn;
+    }
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CameraTypes.h"
+
+namespace FCFW::Headless {
+    // Scripted stand-in for the game state the timeline engine reads: the camera transform at playback start
+    // and references moving along keyframed transforms (actors also carry head and torso nodes).
+    //
+    // World script (YAML, angles in degrees unless useDegrees is false):
+    //   useDegrees: true
+//   camera: { position: [x, y, z], rotation: [pitch, roll, yaw], fov: 80 }
+    //   references:
+    //     - editorID: MyActor
+    //       formID: 0x14
+    //       plugin: Skyrim.esm
+    //       actor: true
+    //       bodyParts: { head: [0, 0, 120], torso: [0, 0, 80] }   # offsets in the actor's local frame
+    //       keys:
+    //         - { time: 0.0, position: [x, y, z], rotation: [pitch, roll, yaw] }
+    //         - { time: 5.0, position: [x, y, z], rotation: [pitch, roll, yaw], loaded: false }
+    class StandInWorld {
+    public:
+        static StandInWorld& GetSingleton();
+
+        bool LoadFromFile(const std::string& a_filePath);
+        void Clear();
+
+        // Adds a reference without keys (held at the origin); frame replay answers its resolutions from the capture
+        RE::TESObjectREFR* AddReference(RE::FormID a_formID, const std::string& a_editorID, const std::string& a_plugin, bool a_isActor);
+
+        // Moves every reference to its scripted transform at a_time (linear between keys, held outside them)
+        void SetTime(float a_time);
+
+        void SetCamera(const RE::NiPoint3& a_position, const RE::NiPoint3& a_rotation, float a_fov);
+        const RE::NiPoint3& GetCameraPosition() const { return m_cameraPosition; }
+        const RE::NiPoint3& GetCameraRotation() const { return m_cameraRotation; }
+
+        RE::TESForm* LookupByID(RE::FormID a_formID) const;
+        RE::TESForm* LookupByEditorID(std::string_view a_editorID) const;
+        RE::NiAVObject* GetBodyPartNode(const RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb) const;
+
+    private:
+        struct Key {
+            float m_time;
+            RE::NiPoint3 m_position;
+            RE::NiPoint3 m_rotation;
+            bool m_isLoaded;
+        };
+
+        struct BodyPartNode {
+            RE::BGSBodyPartDefs::LIMB_ENUM m_limb;
+            RE::NiPoint3 m_offset;  // actor local frame
+            std::unique_ptr<RE::NiAVObject> m_node;
+        };
+
+        struct ScriptedReference {
+            std::unique_ptr<RE::TESObjectREFR> m_form;
+            std::unique_ptr<RE::NiAVObject> m_root;
+            std::vector<BodyPartNode> m_bodyParts;
+            std::vector<Key> m_keys;  // sorted by time
+        };
+
+        StandInWorld() = default;
+
+        RE::TESFile* GetFile(const std::string& a_fileName);
+
+        RE::NiPoint3 m_cameraPosition;
+        RE::NiPoint3 m_cameraRotation;  // pitch=x, roll=y, yaw=z
+        std::vector<ScriptedReference> m_references;
+        std::vector<std::unique_ptr<RE::TESFile>> m_files;
+    };
+
+    // Rotation matrix of Euler angles (pitch=x, roll=y, yaw=z): columns are right, forward and up
+    RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& a_rotation);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include "Timeline.h"
+#include "PlaybackFrame.h"
+
+namespace FCFW::Headless {
+    // Playback globals of a timeline file that live in TimelineState in the plugin
+    struct TimelineFileSettings {
+        bool m_globalEaseIn = false;
+        bool m_globalEaseOut = false;
+        bool m_followGround = false;
+        float m_minHeightAboveGround = 0.0f;
+    };
+
+    // Reads a timeline file into a_timeline the way TimelineManager::AddTimelineFromFile does (same globals, same
+    // import order); false if a section fails to import or the file does not parse
+    bool LoadTimelineFile(const std::string& a_filePath, Timeline& a_timeline, TimelineFileSettings& a_settings);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+// Headless stand-in for the TS_SKSEFunctions calls the timeline engine makes. The math helpers are
+// self-contained; camera and body part queries are answered by StandInWorld.
+constexpr float PI = 3.1415926535f;
+
+namespace _ts_SKSEFunctions {
+    inline float NormalRelativeAngle(float a_angle) {
+        constexpr float twoPi = 2.0f * PI;
+        a_angle = std::fmod(a_angle + PI, twoPi);
+        if (a_angle < 0.0f) {
+            a_angle += twoPi;
+        }
+        return a_angle - PI;
+    }
+
+    // Stand-in easing curves: quadratic ease in / ease out, smoothstep for both
+    inline float ApplyEasing(float a_t, bool a_easeIn, bool a_easeOut) {
+        if (a_easeIn && a_easeOut) {
+            return a_t * a_t * (3.0f - 2.0f * a_t);
+        }
+        if (a_easeIn) {
+            return a_t * a_t;
+        }
+        if (a_easeOut) {
+            return 1.0f - (1.0f - a_t) * (1.0f - a_t);
+        }
+        return a_t;
+    }
+
+    RE::NiPoint3 GetCameraPos();
+    RE::NiPoint3 GetCameraRotation();  // pitch=x, yaw=z (roll comes from FreeCameraRollHook)
+
+    // Body part node of a stand-in actor, its frame (columns of the node rotation) and its Euler angles
+    RE::NiAVObject* GetTargetPoint(RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb);
+    void GetBodyPartCoordinateFrame(RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb, RE::NiPoint3& a_forward, RE::NiPoint3& a_right, RE::NiPoint3& a_up);
+    RE::NiPoint3 GetBodyPartRotation(RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb);
+}
@@ -0,0 +1,263 @@
+#include "StandInWorld.h"
+#include "HeadlessHooks.h"
+#include "_ts_SKSEFunctions.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace FCFW::Headless {
+    namespace {
+        RE::NiPoint3 ReadVector(const YAML::Node& a_node, float a_factor = 1.0f) {
+            if (!a_node || !a_node.IsSequence() || a_node.size() != 3) {
+                return RE::NiPoint3{};
+            }
+            return RE::NiPoint3{ a_node[0].as<float>() * a_factor, a_node[1].as<float>() * a_factor, a_node[2].as<float>() * a_factor };
+        }
+
+        RE::NiPoint3 Rotate(const RE::NiMatrix3& a_rotation, const RE::NiPoint3& a_vector) {
+            return RE::NiPoint3{
+                a_rotation.entry[0][0] * a_vector.x + a_rotation.entry[0][1] * a_vector.y + a_rotation.entry[0][2] * a_vector.z,
+                a_rotation.entry[1][0] * a_vector.x + a_rotation.entry[1][1] * a_vector.y + a_rotation.entry[1][2] * a_vector.z,
+                a_rotation.entry[2][0] * a_vector.x + a_rotation.entry[2][1] * a_vector.y + a_rotation.entry[2][2] * a_vector.z
+            };
+        }
+
+        RE::NiPoint3 Column(const RE::NiMatrix3& a_rotation, int a_column) {
+            return RE::NiPoint3{ a_rotation.entry[0][a_column], a_rotation.entry[1][a_column], a_rotation.entry[2][a_column] };
+        }
+    }
+
+    RE::NiMatrix3 EulerToMatrix(const RE::NiPoint3& a_rotation) {
+        const float sp = std::sin(a_rotation.x);
+        const float cp = std::cos(a_rotation.x);
+        const float sr = std::sin(a_rotation.y);
+        const float cr = std::cos(a_rotation.y);
+        const float sy = std::sin(a_rotation.z);
+        const float cy = std::cos(a_rotation.z);
+
+        // Unrolled frame: forward from pitch and yaw, then right and up turned about forward by roll
+        const RE::NiPoint3 forward{ sy * cp, cy * cp, -sp };
+        const RE::NiPoint3 flatRight{ cy, -sy, 0.0f };
+        const RE::NiPoint3 flatUp = flatRight.Cross(forward);
+        const RE::NiPoint3 right = flatRight * cr - flatUp * sr;
+        const RE::NiPoint3 up = flatUp * cr + flatRight * sr;
+
+        RE::NiMatrix3 matrix;
+        const RE::NiPoint3* columns[3] = { &right, &forward, &up };
+        for (int j = 0; j < 3; ++j) {
+            matrix.entry[0][j] = columns[j]->x;
+            matrix.entry[1][j] = columns[j]->y;
+            matrix.entry[2][j] = columns[j]->z;
+        }
+        return matrix;
+    }
+
+    StandInWorld& StandInWorld::GetSingleton() {
+        static StandInWorld singleton;
+        return singleton;
+    }
+
+    void StandInWorld::Clear() {
+        m_cameraPosition = RE::NiPoint3{};
+        m_cameraRotation = RE::NiPoint3{};
+        RE::PlayerCamera::GetSingleton()->worldFOV = 80.0f;
+        m_references.clear();
+        m_files.clear();
+    }
+
+    bool StandInWorld::LoadFromFile(const std::string& a_filePath) {
+        Clear();
+        try {
+            YAML::Node root = YAML::LoadFile(a_filePath);
+            const float factor = root["useDegrees"].as<bool>(true) ? PI / 180.0f : 1.0f;
+
+            if (auto camera = root["camera"]) {
+                SetCamera(ReadVector(camera["position"]), ReadVector(camera["rotation"], factor), camera["fov"].as<float>(80.0f));
+            }
+
+            for (const auto& refNode : root["references"]) {
+                const bool isActor = refNode["actor"].as<bool>(false);
+                AddReference(static_cast<RE::FormID>(std::stoul(refNode["formID"].as<std::string>("0"), nullptr, 16)), refNode["editorID"].as<std::string>(""),
+                             refNode["plugin"].as<std::string>(""), isActor);
+                ScriptedReference& scripted = m_references.back();
+
+                if (isActor) {
+                    const auto bodyParts = refNode["bodyParts"];
+                    const std::pair<const char*, RE::BGSBodyPartDefs::LIMB_ENUM> limbs[] = {
+                        { "head", RE::BGSBodyPartDefs::LIMB_ENUM::kHead },
+                        { "torso", RE::BGSBodyPartDefs::LIMB_ENUM::kTorso }
+                    };
+                    for (const auto& [name, limb] : limbs) {
+                        const RE::NiPoint3 defaultOffset = limb == RE::BGSBodyPartDefs::LIMB_ENUM::kHead ? RE::NiPoint3{ 0.0f, 0.0f, 120.0f } : RE::NiPoint3{ 0.0f, 0.0f, 80.0f };
+                        const RE::NiPoint3 offset = bodyParts && bodyParts[name] ? ReadVector(bodyParts[name]) : defaultOffset;
+                        scripted.m_bodyParts.push_back(BodyPartNode{ limb, offset, std::make_unique<RE::NiAVObject>() });
+                    }
+                }
+
+                if (refNode["keys"].size() > 0) {
+                    scripted.m_keys.clear();  // Replaces the resting key of AddReference
+                }
+                for (const auto& keyNode : refNode["keys"]) {
+                    scripted.m_keys.push_back(Key{ keyNode["time"].as<float>(0.0f), ReadVector(keyNode["position"]),
+                                                   ReadVector(keyNode["rotation"], factor), keyNode["loaded"].as<bool>(true) });
+                }
+                std::stable_sort(scripted.m_keys.begin(), scripted.m_keys.end(), [](const Key& a, const Key& b) { return a.m_time < b.m_time; });
+            }
+        } catch (const std::exception& e) {
+            log::error("{}: Failed to load world script {}: {}", __FUNCTION__, a_filePath, e.what());
+            Clear();
+            return false;
+        }
+
+        SetTime(0.0f);
+        log::info("{}: Loaded {} scripted references from {}", __FUNCTION__, m_references.size(), a_filePath);
+        return true;
+    }
+
+    RE::TESObjectREFR* StandInWorld::AddReference(RE::FormID a_formID, const std::string& a_editorID, const std::string& a_plugin, bool a_isActor) {
+        ScriptedReference& scripted = m_references.emplace_back();
+        scripted.m_form = a_isActor ? std::make_unique<RE::Actor>() : std::make_unique<RE::TESObjectREFR>();
+        scripted.m_root = std::make_unique<RE::NiAVObject>();
+        scripted.m_form->root = scripted.m_root.get();
+        scripted.m_form->formID = a_formID;
+        scripted.m_form->editorID = a_editorID;
+        if (!a_plugin.empty()) {
+            scripted.m_form->file = GetFile(a_plugin);
+        }
+        scripted.m_keys.push_back(Key{ 0.0f, RE::NiPoint3{}, RE::NiPoint3{}, true });
+        return scripted.m_form.get();
+    }
+
+    void StandInWorld::SetTime(float a_time) {
+        for (auto& scripted : m_references) {
+            const auto& keys = scripted.m_keys;
+            auto next = std::upper_bound(keys.begin(), keys.end(), a_time, [](float time, const Key& key) { return time < key.m_time; });
+
+            RE::NiPoint3 position;
+            RE::NiPoint3 rotation;
+            bool isLoaded;
+            if (next == keys.begin() || next == keys.end()) {
+                const Key& key = next == keys.begin() ? keys.front() : keys.back();
+                position = key.m_position;
+                rotation = key.m_rotation;
+                isLoaded = key.m_isLoaded;
+            } else {
+                const Key& from = *(next - 1);
+                const Key& to = *next;
+                const float t = (a_time - from.m_time) / (to.m_time - from.m_time);
+                position = from.m_position + (to.m_position - from.m_position) * t;
+                rotation = RE::NiPoint3{
+                    from.m_rotation.x + _ts_SKSEFunctions::NormalRelativeAngle(to.m_rotation.x - from.m_rotation.x) * t,
+                    from.m_rotation.y + _ts_SKSEFunctions::NormalRelativeAngle(to.m_rotation.y - from.m_rotation.y) * t,
+                    from.m_rotation.z + _ts_SKSEFunctions::NormalRelativeAngle(to.m_rotation.z - from.m_rotation.z) * t
+                };
+                isLoaded = from.m_isLoaded;
+            }
+
+            RE::TESObjectREFR* form = scripted.m_form.get();
+            form->position = position;
+            form->angle = rotation;
+            form->is3DLoaded = isLoaded;
+
+            const RE::NiMatrix3 matrix = EulerToMatrix(rotation);
+            scripted.m_root->world.translate = position;
+            scripted.m_root->world.rotate = matrix;
+            for (auto& bodyPart : scripted.m_bodyParts) {
+                bodyPart.m_node->world.translate = position + Rotate(matrix, bodyPart.m_offset);
+                bodyPart.m_node->world.rotate = matrix;
+            }
+        }
+    }
+
+    void StandInWorld::SetCamera(const RE::NiPoint3& a_position, const RE::NiPoint3& a_rotation, float a_fov) {
+        m_cameraPosition = a_position;
+        m_cameraRotation = a_rotation;
+        RE::PlayerCamera::GetSingleton()->worldFOV = a_fov;
+    }
+
+    RE::TESForm* StandInWorld::LookupByID(RE::FormID a_formID) const {
+        for (const auto& scripted : m_references) {
+            if (scripted.m_form->formID == a_formID) {
+                return scripted.m_form.get();
+            }
+        }
+        return nullptr;
+    }
+
+    RE::TESForm* StandInWorld::LookupByEditorID(std::string_view a_editorID) const {
+        for (const auto& scripted : m_references) {
+            if (!a_editorID.empty() && scripted.m_form->editorID == a_editorID) {
+                return scripted.m_form.get();
+            }
+        }
+        return nullptr;
+    }
+
+    RE::NiAVObject* StandInWorld::GetBodyPartNode(const RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb) const {
+        for (const auto& scripted : m_references) {
+            if (scripted.m_form.get() != a_actor || !a_actor->Is3DLoaded()) {
+                continue;
+            }
+            for (const auto& bodyPart : scripted.m_bodyParts) {
+                if (bodyPart.m_limb == a_limb) {
+                    return bodyPart.m_node.get();
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    RE::TESFile* StandInWorld::GetFile(const std::string& a_fileName) {
+        for (const auto& file : m_files) {
+            if (a_fileName == file->fileName) {
+                return file.get();
+            }
+        }
+        auto& file = m_files.emplace_back(std::make_unique<RE::TESFile>());
+        std::strncpy(file->fileName, a_fileName.c_str(), sizeof(file->fileName) - 1);
+        return file.get();
+    }
+}
+
+namespace RE {
+    TESForm* TESForm::LookupByID(FormID a_formID) {
+        return FCFW::Headless::StandInWorld::GetSingleton().LookupByID(a_formID);
+    }
+
+    TESForm* TESForm::LookupByEditorIDImpl(std::string_view a_editorID) {
+        return FCFW::Headless::StandInWorld::GetSingleton().LookupByEditorID(a_editorID);
+    }
+}
+
+namespace _ts_SKSEFunctions {
+    RE::NiPoint3 GetCameraPos() {
+        return FCFW::Headless::StandInWorld::GetSingleton().GetCameraPosition();
+    }
+
+    RE::NiPoint3 GetCameraRotation() {
+        return FCFW::Headless::StandInWorld::GetSingleton().GetCameraRotation();
+    }
+
+    RE::NiAVObject* GetTargetPoint(RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb) {
+        return FCFW::Headless::StandInWorld::GetSingleton().GetBodyPartNode(a_actor, a_limb);
+    }
+
+    void GetBodyPartCoordinateFrame(RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb, RE::NiPoint3& a_forward, RE::NiPoint3& a_right, RE::NiPoint3& a_up) {
+        RE::NiAVObject* node = GetTargetPoint(a_actor, a_limb);
+        if (!node) {
+            return;
+        }
+        a_right = FCFW::Headless::Column(node->world.rotate, 0);
+        a_forward = FCFW::Headless::Column(node->world.rotate, 1);
+        a_up = FCFW::Headless::Column(node->world.rotate, 2);
+    }
+
+    RE::NiPoint3 GetBodyPartRotation(RE::Actor* a_actor, RE::BGSBodyPartDefs::LIMB_ENUM a_limb) {
+        return GetTargetPoint(a_actor, a_limb) ? a_actor->angle : RE::NiPoint3{};
+    }
+}
+
+namespace Hooks {
+    float FreeCameraRollHook::GetFreeCameraRoll() {
+        return FCFW::Headless::StandInWorld::GetSingleton().GetCameraRotation().y;
+    }
+}
@@ -0,0 +1,39 @@
+#include "TimelineFile.h"
+#include "FCFW_Utils.h"
+
+#include <yaml-cpp/yaml.h>
+
+namespace FCFW::Headless {
+    bool LoadTimelineFile(const std::string& a_filePath, Timeline& a_timeline, TimelineFileSettings& a_settings) {
+        try {
+            YAML::Node root = YAML::LoadFile(a_filePath);
+
+            if (root["playbackMode"]) {
+                a_timeline.SetPlaybackMode(StringToPlaybackMode(root["playbackMode"].as<std::string>()));
+            }
+            if (root["loopTimeOffset"]) {
+                a_timeline.SetLoopTimeOffset(root["loopTimeOffset"].as<float>());
+            }
+            a_settings.m_globalEaseIn = root["globalEaseIn"].as<bool>(false);
+            a_settings.m_globalEaseOut = root["globalEaseOut"].as<bool>(false);
+            a_settings.m_followGround = root["followGround"].as<bool>(false);
+            a_settings.m_minHeightAboveGround = root["minHeightAboveGround"].as<float>(0.0f);
+
+            float rotationConversionFactor = 1.0f;
+            if (root["useDegrees"].as<bool>(false)) {
+                rotationConversionFactor = PI / 180.0f;
+            }
+
+            if (!a_timeline.AddTranslationPathFromFile(a_filePath) ||
+                !a_timeline.AddRotationPathFromFile(a_filePath, 0.0f, rotationConversionFactor) ||
+                !a_timeline.AddFOVPathFromFile(a_filePath)) {
+                log::error("{}: Failed to import timeline {}", __FUNCTION__, a_filePath);
+                return false;
+            }
+        } catch (const YAML::Exception& e) {
+            log::error("{}: Failed to parse timeline {}: {}", __FUNCTION__, a_filePath, e.what());
+            return false;
+        }
+        return true;
+    }
+}
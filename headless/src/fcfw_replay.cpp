@@ -0,0 +1,268 @@
+// fcfw-replay: replays a frame capture (see FrameCapture.h) through AdvancePlayback with the captured game inputs,
+// reports per-frame cost percentiles and checks the produced camera transforms against a golden file.
+//
+//   fcfw-replay <capture.fcfwcap> [--timeline file.yaml] [--iterations n] [--golden file.csv] [--write-golden file.csv]
+//               [--tolerance x] [--max-p99 us] [--check-capture]
+//
+// Exit code 1 if the golden file differs, the p99 frame cost exceeds --max-p99, or (--check-capture) the replay
+// differs from the transforms recorded in game.
+
+#include "FrameCapture.h"
+#include "StandInWorld.h"
+#include "TimelineFile.h"
+#include "_ts_SKSEFunctions.h"
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+namespace {
+    struct Options {
+        std::string m_capturePath;
+        std::string m_timelinePath;  // Default: the export next to the capture
+        std::string m_goldenPath;
+        std::string m_writeGoldenPath;
+        size_t m_iterations = 20;
+        float m_tolerance = 0.01f;   // Game units, degrees and FOV degrees
+        double m_maxP99 = 0.0;       // Microseconds, 0 = no limit
+        bool m_checkCapture = false;
+    };
+
+    void PrintUsage() {
+        std::cerr << "usage: fcfw-replay <capture.fcfwcap> [--timeline file.yaml] [--iterations n] [--golden file.csv]\n"
+                     "                   [--write-golden file.csv] [--tolerance x] [--max-p99 us] [--check-capture]\n";
+    }
+
+    bool ParseOptions(int a_argc, char** a_argv, Options& a_options) {
+        for (int i = 1; i < a_argc; ++i) {
+            const std::string_view arg = a_argv[i];
+            const bool hasValue = i + 1 < a_argc;
+            if (arg == "--timeline" && hasValue) {
+                a_options.m_timelinePath = a_argv[++i];
+            } else if (arg == "--iterations" && hasValue) {
+                a_options.m_iterations = std::max<size_t>(1, std::stoul(a_argv[++i]));
+            } else if (arg == "--golden" && hasValue) {
+                a_options.m_goldenPath = a_argv[++i];
+            } else if (arg == "--write-golden" && hasValue) {
+                a_options.m_writeGoldenPath = a_argv[++i];
+            } else if (arg == "--tolerance" && hasValue) {
+                a_options.m_tolerance = std::stof(a_argv[++i]);
+            } else if (arg == "--max-p99" && hasValue) {
+                a_options.m_maxP99 = std::stod(a_argv[++i]);
+            } else if (arg == "--check-capture") {
+                a_options.m_checkCapture = true;
+            } else if (!arg.starts_with("--") && a_options.m_capturePath.empty()) {
+                a_options.m_capturePath = arg;
+            } else {
+                return false;
+            }
+        }
+        return !a_options.m_capturePath.empty();
+    }
+
+    // Golden row: position, rotation in degrees (pitch, roll, yaw) and FOV (0 without FOV points)
+    using GoldenRow = std::array<float, 7>;
+
+    GoldenRow ToGoldenRow(const FCFW::PlaybackFrame& a_frame) {
+        constexpr float toDegrees = 180.0f / PI;
+        return GoldenRow{ a_frame.m_position.x, a_frame.m_position.y, a_frame.m_position.z,
+                          _ts_SKSEFunctions::NormalRelativeAngle(a_frame.m_rotation.x) * toDegrees,
+                          _ts_SKSEFunctions::NormalRelativeAngle(a_frame.m_rotation.y) * toDegrees,
+                          _ts_SKSEFunctions::NormalRelativeAngle(a_frame.m_rotation.z) * toDegrees,
+                          a_frame.m_hasFOV ? a_frame.m_fov : 0.0f };
+    }
+
+    // Largest difference of two rows, angles compared on the circle
+    float RowDifference(const GoldenRow& a_lhs, const GoldenRow& a_rhs) {
+        float difference = 0.0f;
+        for (size_t i = 0; i < a_lhs.size(); ++i) {
+            float delta = std::abs(a_lhs[i] - a_rhs[i]);
+            if (i >= 3 && i <= 5) {
+                delta = std::min(delta, 360.0f - delta);
+            }
+            difference = std::max(difference, delta);
+        }
+        return difference;
+    }
+
+    bool WriteGolden(const std::string& a_filePath, const std::vector<GoldenRow>& a_rows) {
+        std::ofstream file(a_filePath);
+        if (!file) {
+            log::error("Failed to open {} for writing", a_filePath);
+            return false;
+        }
+        file << "frame,x,y,z,pitch,roll,yaw,fov\n";
+        char line[256];
+        for (size_t i = 0; i < a_rows.size(); ++i) {
+            const GoldenRow& row = a_rows[i];
+            std::snprintf(line, sizeof(line), "%zu,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n", i, row[0], row[1], row[2], row[3], row[4], row[5], row[6]);
+            file << line;
+        }
+        return true;
+    }
+
+    bool ReadGolden(const std::string& a_filePath, std::vector<GoldenRow>& a_rows) {
+        std::ifstream file(a_filePath);
+        if (!file) {
+            log::error("Failed to open golden file {}", a_filePath);
+            return false;
+        }
+        std::string line;
+        std::getline(file, line);  // Header
+        while (std::getline(file, line)) {
+            std::replace(line.begin(), line.end(), ',', ' ');
+            std::istringstream stream(line);
+            size_t frame = 0;
+            GoldenRow row{};
+            if (!(stream >> frame >> row[0] >> row[1] >> row[2] >> row[3] >> row[4] >> row[5] >> row[6])) {
+                log::error("Malformed golden row {}: {}", a_rows.size(), line);
+                return false;
+            }
+            a_rows.push_back(row);
+        }
+        return true;
+    }
+
+    // Frames beyond the tolerance, with the first one and the largest difference for the report
+    struct Comparison {
+        size_t m_mismatches = 0;
+        size_t m_firstMismatch = 0;
+        float m_maxDifference = 0.0f;
+    };
+
+    Comparison Compare(const std::vector<GoldenRow>& a_expected, const std::vector<GoldenRow>& a_actual, float a_tolerance) {
+        Comparison comparison;
+        const size_t count = std::min(a_expected.size(), a_actual.size());
+        for (size_t i = 0; i < count; ++i) {
+            const float difference = RowDifference(a_expected[i], a_actual[i]);
+            comparison.m_maxDifference = std::max(comparison.m_maxDifference, difference);
+            if (difference > a_tolerance && comparison.m_mismatches++ == 0) {
+                comparison.m_firstMismatch = i;
+            }
+        }
+        if (a_expected.size() != a_actual.size()) {
+            comparison.m_firstMismatch = comparison.m_mismatches == 0 ? count : comparison.m_firstMismatch;
+            comparison.m_mismatches += std::max(a_expected.size(), a_actual.size()) - count;
+        }
+        return comparison;
+    }
+
+    double Percentile(const std::vector<double>& a_sorted, double a_fraction) {
+        const size_t index = static_cast<size_t>(a_fraction * static_cast<double>(a_sorted.size() - 1) + 0.5);
+        return a_sorted[std::min(index, a_sorted.size() - 1)];
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 2;
+    }
+
+    spdlog::set_default_logger(spdlog::stderr_color_st("fcfw-replay"));
+    spdlog::set_pattern("[%l] %v");
+    spdlog::set_level(spdlog::level::warn);
+
+    FCFW::CapturedSession session;
+    if (!FCFW::FrameCapture::ReadFile(options.m_capturePath, session)) {
+        return 1;
+    }
+
+    // Stand-ins for every captured reference, so the timeline's reference points resolve to them
+    auto& world = FCFW::Headless::StandInWorld::GetSingleton();
+    world.SetCamera(session.m_cameraPosition, session.m_cameraRotation, session.m_cameraFOV);
+    for (const auto& form : session.m_forms) {
+        world.AddReference(form.m_formID, form.m_editorID, form.m_plugin, form.m_isActor);
+    }
+
+    const std::string timelinePath = options.m_timelinePath.empty() ? FCFW::FrameCapture::GetTimelineFilePath(options.m_capturePath).string() : options.m_timelinePath;
+    FCFW::Timeline timeline;
+    FCFW::Headless::TimelineFileSettings fileSettings;
+    if (!FCFW::Headless::LoadTimelineFile(timelinePath, timeline, fileSettings)) {
+        return 1;
+    }
+
+    // Same start sequence as TimelineManager::StartPlayback, then the captured frames in order
+    auto& replay = FCFW::FrameReplay::GetSingleton();
+    const auto landHeight = [&replay](const RE::NiPoint3& a_position) { return replay.GetLandHeight(a_position); };
+    std::vector<double> frameCosts;
+    frameCosts.reserve(session.m_frames.size() * options.m_iterations);
+    std::vector<GoldenRow> replayed;
+    for (size_t iteration = 0; iteration < options.m_iterations; ++iteration) {
+        timeline.ResetPlayback();
+        timeline.SetGlobalEasing(session.m_globalEaseIn, session.m_globalEaseOut);
+        timeline.StartPlayback();
+        if (session.m_startTime > 0.0f) {
+            timeline.SetPlaybackTime(session.m_startTime);
+        }
+
+        for (const auto& capturedFrame : session.m_frames) {
+            replay.SetFrame(&capturedFrame);
+            const auto start = std::chrono::steady_clock::now();
+            FCFW::PlaybackFrame frame;
+            {
+                FCFW::ReferenceCache::FrameScope referenceFrame;
+                frame = FCFW::AdvancePlayback(timeline, session.m_settings, capturedFrame.m_realDeltaTime, landHeight);
+            }
+            const auto end = std::chrono::steady_clock::now();
+            frameCosts.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+            if (iteration == 0) {
+                replayed.push_back(ToGoldenRow(frame));
+            }
+        }
+    }
+    replay.SetFrame(nullptr);
+
+    std::vector<double> sorted = frameCosts;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (double cost : sorted) {
+        total += cost;
+    }
+    const double p99 = sorted.empty() ? 0.0 : Percentile(sorted, 0.99);
+    std::printf("frames: %zu x %zu iterations, %zu references\n", session.m_frames.size(), options.m_iterations, session.m_forms.size());
+    if (!sorted.empty()) {
+        std::printf("frame cost (us): mean %.3f  p50 %.3f  p90 %.3f  p99 %.3f  p99.9 %.3f  max %.3f\n", total / static_cast<double>(sorted.size()),
+                    Percentile(sorted, 0.5), Percentile(sorted, 0.9), p99, Percentile(sorted, 0.999), sorted.back());
+    }
+
+    int result = 0;
+
+    std::vector<GoldenRow> captured;
+    for (const auto& capturedFrame : session.m_frames) {
+        captured.push_back(ToGoldenRow(capturedFrame.m_output));
+    }
+    const Comparison captureComparison = Compare(captured, replayed, options.m_tolerance);
+    std::printf("vs capture: %zu frames beyond %.4f, max difference %.4f\n", captureComparison.m_mismatches, options.m_tolerance, captureComparison.m_maxDifference);
+    if (options.m_checkCapture && captureComparison.m_mismatches > 0) {
+        std::printf("FAIL: replay differs from the captured output from frame %zu\n", captureComparison.m_firstMismatch);
+        result = 1;
+    }
+
+    if (!options.m_goldenPath.empty()) {
+        std::vector<GoldenRow> golden;
+        if (!ReadGolden(options.m_goldenPath, golden)) {
+            return 1;
+        }
+        const Comparison goldenComparison = Compare(golden, replayed, options.m_tolerance);
+        std::printf("vs golden: %zu frames beyond %.4f, max difference %.4f\n", goldenComparison.m_mismatches, options.m_tolerance, goldenComparison.m_maxDifference);
+        if (goldenComparison.m_mismatches > 0) {
+            std::printf("FAIL: output differs from %s from frame %zu\n", options.m_goldenPath.c_str(), goldenComparison.m_firstMismatch);
+            result = 1;
+        }
+    }
+
+    if (!options.m_writeGoldenPath.empty() && !WriteGolden(options.m_writeGoldenPath, replayed)) {
+        return 1;
+    }
+
+    if (options.m_maxP99 > 0.0 && p99 > options.m_maxP99) {
+        std::printf("FAIL: p99 frame cost %.3f us exceeds %.3f us\n", p99, options.m_maxP99);
+        result = 1;
+    }
+
+    return result;
+}
@@ -0,0 +1,160 @@
+// fcfw-sample: plays a timeline file through the headless core at a fixed frame rate and writes the camera
+// samples as CSV, advancing and sampling like TimelineManager::PlayTimeline (AdvancePlayback). Ground following is
+// not simulated. With --capture the run is also written as a frame capture for fcfw-replay.
+
+#include "FrameCapture.h"
+#include "StandInWorld.h"
+#include "TimelineFile.h"
+#include "_ts_SKSEFunctions.h"
+
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+#include <iostream>
+
+namespace {
+    struct Options {
+        std::string m_timelinePath;
+        std::string m_worldPath;
+        std::string m_outPath;
+        std::string m_capturePath;
+        float m_rate = 60.0f;
+        float m_speed = 1.0f;
+        float m_duration = 0.0f;  // Playback seconds for loop and wait modes, 0 = one timeline duration
+        bool m_constantSpeed = false;
+    };
+
+    void PrintUsage() {
+        std::cerr << "usage: fcfw-sample <timeline.yaml> [--rate Hz] [--speed x] [--duration s] [--constant-speed]\n"
+                     "                   [--world world.yaml] [--out samples.csv] [--capture run.fcfwcap]\n";
+    }
+
+    bool ParseOptions(int a_argc, char** a_argv, Options& a_options) {
+        for (int i = 1; i < a_argc; ++i) {
+            const std::string_view arg = a_argv[i];
+            const bool hasValue = i + 1 < a_argc;
+            if (arg == "--rate" && hasValue) {
+                a_options.m_rate = std::stof(a_argv[++i]);
+            } else if (arg == "--speed" && hasValue) {
+                a_options.m_speed = std::stof(a_argv[++i]);
+            } else if (arg == "--duration" && hasValue) {
+                a_options.m_duration = std::stof(a_argv[++i]);
+            } else if (arg == "--world" && hasValue) {
+                a_options.m_worldPath = a_argv[++i];
+            } else if (arg == "--out" && hasValue) {
+                a_options.m_outPath = a_argv[++i];
+            } else if (arg == "--capture" && hasValue) {
+                a_options.m_capturePath = a_argv[++i];
+            } else if (arg == "--constant-speed") {
+                a_options.m_constantSpeed = true;
+            } else if (!arg.starts_with("--") && a_options.m_timelinePath.empty()) {
+                a_options.m_timelinePath = arg;
+            } else {
+                return false;
+            }
+        }
+        return !a_options.m_timelinePath.empty() && a_options.m_rate > 0.0f && a_options.m_speed > 0.0f;
+    }
+
+    float ToDegrees(float a_radians) {
+        return a_radians * 180.0f / PI;
+    }
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!ParseOptions(argc, argv, options)) {
+        PrintUsage();
+        return 2;
+    }
+
+    // Samples go to stdout, diagnostics to stderr
+    spdlog::set_default_logger(spdlog::stderr_color_st("fcfw-sample"));
+    spdlog::set_pattern("[%l] %v");
+    spdlog::set_level(spdlog::level::warn);
+
+    auto& world = FCFW::Headless::StandInWorld::GetSingleton();
+    if (!options.m_worldPath.empty() && !world.LoadFromFile(options.m_worldPath)) {
+        return 1;
+    }
+
+    FCFW::Timeline timeline;
+    FCFW::Headless::TimelineFileSettings fileSettings;
+    if (!FCFW::Headless::LoadTimelineFile(options.m_timelinePath, timeline, fileSettings)) {
+        return 1;
+    }
+    if (fileSettings.m_followGround) {
+        log::info("followGround is set but there is no landscape in the headless core, ignoring");
+    }
+
+    if (timeline.GetTranslationPointCount() == 0 && timeline.GetRotationPointCount() == 0) {
+        log::error("Timeline {} has no translation or rotation points", options.m_timelinePath);
+        return 1;
+    }
+    if (options.m_constantSpeed && !timeline.SupportsConstantSpeed()) {
+        log::warn("Timeline does not support constant speed playback, sampling by key times");
+        options.m_constantSpeed = false;
+    }
+
+    std::ofstream file;
+    if (!options.m_outPath.empty()) {
+        file.open(options.m_outPath);
+        if (!file) {
+            log::error("Failed to open {} for writing", options.m_outPath);
+            return 1;
+        }
+    }
+    std::ostream& out = options.m_outPath.empty() ? std::cout : file;
+
+    const FCFW::PlaybackFrameSettings settings{ options.m_speed, options.m_constantSpeed, false, 0.0f };
+    timeline.ResetPlayback();
+    timeline.SetGlobalEasing(fileSettings.m_globalEaseIn, fileSettings.m_globalEaseOut);
+    timeline.StartPlayback();
+
+    auto& capture = FCFW::FrameCapture::GetSingleton();
+    if (!options.m_capturePath.empty()) {
+        if (!capture.Arm(options.m_capturePath)) {
+            return 1;
+        }
+        FCFW::CapturedSession session;
+        session.m_settings = settings;
+        session.m_globalEaseIn = fileSettings.m_globalEaseIn;
+        session.m_globalEaseOut = fileSettings.m_globalEaseOut;
+        session.m_cameraPosition = world.GetCameraPosition();
+        session.m_cameraRotation = world.GetCameraRotation();
+        session.m_cameraFOV = RE::PlayerCamera::GetSingleton()->worldFOV;
+        capture.BeginSession(session);
+        std::filesystem::copy_file(options.m_timelinePath, FCFW::FrameCapture::GetTimelineFilePath(options.m_capturePath),
+                                   std::filesystem::copy_options::overwrite_existing);
+    }
+
+    const bool endsOnItsOwn = timeline.GetPlaybackMode() == FCFW::PlaybackMode::kEnd;
+    const float playbackDuration = options.m_duration > 0.0f ? options.m_duration : timeline.GetDuration() / options.m_speed;
+    const float frameTime = 1.0f / options.m_rate;
+
+    out << "time,x,y,z,pitch,roll,yaw,fov\n";
+    char line[256];
+    for (size_t frameIndex = 0;; ++frameIndex) {
+        const float elapsed = static_cast<float>(frameIndex) * frameTime;
+        world.SetTime(elapsed);
+
+        // The first frame samples the start of playback
+        const float deltaTime = frameIndex > 0 ? frameTime : 0.0f;
+        FCFW::ReferenceCache::FrameScope referenceFrame;
+        capture.BeginFrame(deltaTime);
+        const FCFW::PlaybackFrame frame = FCFW::AdvancePlayback(timeline, settings, deltaTime, nullptr);
+        capture.EndFrame(frame);
+
+        const float fov = frame.m_hasFOV ? frame.m_fov : RE::PlayerCamera::GetSingleton()->worldFOV;
+        std::snprintf(line, sizeof(line), "%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n", elapsed, frame.m_position.x, frame.m_position.y, frame.m_position.z,
+                      ToDegrees(_ts_SKSEFunctions::NormalRelativeAngle(frame.m_rotation.x)), ToDegrees(_ts_SKSEFunctions::NormalRelativeAngle(frame.m_rotation.y)),
+                      ToDegrees(_ts_SKSEFunctions::NormalRelativeAngle(frame.m_rotation.z)), fov);
+        out << line;
+
+        if (endsOnItsOwn ? !timeline.IsPlaying() : elapsed >= playbackDuration) {
+            break;
+        }
+    }
+
+    capture.Disarm();
+    return 0;
+}
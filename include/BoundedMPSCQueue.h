@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace FCFW {
+    // Bounded lock-free queue for many producers and one consumer (Vyukov's bounded queue). Every cell carries a
+    // sequence number: a producer claims a position with one CAS, writes the value and then advances the cell's
+    // sequence, so the consumer never reads a half-written value. Positions are handed out in push order and
+    // popped in the same order. Push fails instead of waiting when the queue is full.
+    template <class T, std::size_t Capacity>
+    class BoundedMPSCQueue {
+        static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+    public:
+        BoundedMPSCQueue() {
+            for (std::size_t i = 0; i < Capacity; ++i) {
+                m_cells[i].m_sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BoundedMPSCQueue(const BoundedMPSCQueue&) = delete;
+        BoundedMPSCQueue& operator=(const BoundedMPSCQueue&) = delete;
+
+        // Any thread. Returns the value's position, or nothing if the queue is full.
+        std::optional<std::uint64_t> Push(const T& a_value) {
+            std::uint64_t position = m_pushPosition.load(std::memory_order_relaxed);
+            for (;;) {
+                Cell& cell = m_cells[position & kMask];
+                const std::uint64_t sequence = cell.m_sequence.load(std::memory_order_acquire);
+                const auto difference = static_cast<std::int64_t>(sequence - position);
+                if (difference == 0) {
+                    if (m_pushPosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                        cell.m_value = a_value;
+                        cell.m_sequence.store(position + 1, std::memory_order_release);
+                        return position;
+                    }
+                } else if (difference < 0) {
+                    return std::nullopt;  // The consumer has not freed this cell yet
+                } else {
+                    position = m_pushPosition.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        // Consumer thread only. Stops at a claimed cell whose value is still being written.
+        bool Pop(T& a_value, std::uint64_t& a_position) {
+            Cell& cell = m_cells[m_popPosition & kMask];
+            if (cell.m_sequence.load(std::memory_order_acquire) != m_popPosition + 1) {
+                return false;
+            }
+            a_value = cell.m_value;
+            a_position = m_popPosition;
+            cell.m_sequence.store(m_popPosition + Capacity, std::memory_order_release);
+            ++m_popPosition;
+            return true;
+        }
+
+        // Consumer thread only
+        bool HasPending() const {
+            return m_cells[m_popPosition & kMask].m_sequence.load(std::memory_order_acquire) == m_popPosition + 1;
+        }
+
+        // Positions claimed so far, by any thread
+        std::uint64_t GetPushCount() const { return m_pushPosition.load(std::memory_order_acquire); }
+
+    private:
+        static constexpr std::uint64_t kMask = Capacity - 1;
+
+        struct Cell {
+            std::atomic<std::uint64_t> m_sequence{ 0 };
+            T m_value{};
+        };
+
+        std::array<Cell, Capacity> m_cells;
+        alignas(64) std::atomic<std::uint64_t> m_pushPosition{ 0 };
+        alignas(64) std::uint64_t m_popPosition{ 0 };
+    };
+} // namespace FCFW
@@ -3,13 +3,25 @@
 #include "CameraTypes.h"
 #include "_ts_SKSEFunctions.h"
 #include "FCFW_Utils.h"
+#ifdef FCFW_HEADLESS
+#include "HeadlessHooks.h"  // stand-in camera roll of the headless core (headless/)
+#else
 #include "Hooks.h"
+#endif
+#include "ReferenceCache.h"
+#include "FrameProfiler.h"
+#include <array>
+#include <optional>
+#include <span>
 #include <stdexcept>
 
 
 namespace FCFW {
     class TranslationPoint {
     public:
+        using ValueType = RE::NiPoint3;
+        using SegmentCoefficients = std::array<CubicCoefficients, 3>;  // x, y, z
+
         TranslationPoint(
             const Transition& a_transition = Transition(0.0f, InterpolationMode::kCubicHermite, false, false),
             PointType a_pointType = PointType::kWorld,
@@ -32,47 +44,29 @@ namespace FCFW {
         }
 
         RE::NiPoint3 GetPoint() const {
-            if (m_pointType == PointType::kReference && m_reference && m_reference->Is3DLoaded()) {
+            if (m_pointType == PointType::kReference && m_reference) {
+                const ResolvedReference reference = ReferenceCache::Resolve(m_reference, m_bodyPart, m_isOffsetRelative);
+                if (!reference.m_isLoaded) {
+                    return m_point;
+                }
+
                 RE::NiPoint3 offset = m_offset;
                 
                 // If offset is relative to reference heading, rotate it
                 if (m_isOffsetRelative) {
-                    RE::Actor* actor = m_reference->As<RE::Actor>();
-                    
-                    // If bodyPart is specified and reference is an actor, use body part's coordinate frame
-                    if (m_bodyPart != BodyPart::kNone && actor) {
-                        auto targetPoint = _ts_SKSEFunctions::GetTargetPoint(actor, BodyPartToLimbEnum(m_bodyPart));
-                        if (targetPoint) {
-                            // Get body part's local coordinate frame (forward, right, up) in world space
-                            RE::NiPoint3 forward, right, up;
-                            _ts_SKSEFunctions::GetBodyPartCoordinateFrame(actor, BodyPartToLimbEnum(m_bodyPart), forward, right, up);
-                            
-                            // Transform offset from standard local frame (right=X, forward=Y, up=Z) to world space
-                            // offset.x = right component, offset.y = forward component, offset.z = up component
-                            offset.x = m_offset.x * right.x + m_offset.y * forward.x + m_offset.z * up.x;
-                            offset.y = m_offset.x * right.y + m_offset.y * forward.y + m_offset.z * up.y;
-                            offset.z = m_offset.x * right.z + m_offset.y * forward.z + m_offset.z * up.z;
-                        } else {
-                            // Fallback to actor root rotation using Euler angles
-                            float yaw = actor->GetHeading(false);
-                            float cosYaw = std::cos(yaw);
-                            float sinYaw = std::sin(yaw);
-                            offset.x = m_offset.y * sinYaw + m_offset.x * cosYaw;
-                            offset.y = m_offset.y * cosYaw - m_offset.x * sinYaw;
-                            offset.z = m_offset.z;
-                        }
-                    } else if (actor) {
-                        // No body part specified, use actor heading (yaw only)
-                        float yaw = actor->GetHeading(false);
-                        float cosYaw = std::cos(yaw);
-                        float sinYaw = std::sin(yaw);
-                        offset.x = m_offset.y * sinYaw + m_offset.x * cosYaw;
-                        offset.y = m_offset.y * cosYaw - m_offset.x * sinYaw;
-                        offset.z = m_offset.z;
+                    if (reference.m_hasBodyFrame) {
+                        // Transform offset from standard local frame (right=X, forward=Y, up=Z) to world space
+                        // offset.x = right component, offset.y = forward component, offset.z = up component
+                        const RE::NiPoint3& forward = reference.m_forward;
+                        const RE::NiPoint3& right = reference.m_right;
+                        const RE::NiPoint3& up = reference.m_up;
+                        offset.x = m_offset.x * right.x + m_offset.y * forward.x + m_offset.z * up.x;
+                        offset.y = m_offset.x * right.y + m_offset.y * forward.y + m_offset.z * up.y;
+                        offset.z = m_offset.x * right.z + m_offset.y * forward.z + m_offset.z * up.z;
                     } else {
-                        // Not an actor, use reference angles
-                        float pitch = m_reference->GetAngleX();
-                        float yaw = m_reference->GetAngleZ();
+                        // Actor heading (pitch is zero) or reference angles
+                        float pitch = reference.m_rotation.x;
+                        float yaw = reference.m_rotation.z;
                         
                         // Yaw rotation (around Z axis)
                         float cosYaw = std::cos(yaw);
@@ -91,52 +85,21 @@ namespace FCFW {
                     }
                 }
                 
-                // Get base position (either from target point or root position)
-                RE::NiPoint3 basePosition;
-                if (m_bodyPart != BodyPart::kNone) {
-                    RE::Actor* actor = m_reference->As<RE::Actor>();
-                    if (actor) {
-                        auto targetPoint = _ts_SKSEFunctions::GetTargetPoint(actor, BodyPartToLimbEnum(m_bodyPart));
-                        if (targetPoint) {
-                            basePosition = targetPoint->world.translate;
-                        } else {
-                            // Fallback to root position if target point not found
-                            basePosition = m_reference->GetPosition();
-                        }
-                    } else {
-                        // Non-actor reference: use root position
-                        basePosition = m_reference->GetPosition();
-                    }
-                } else {
-                    basePosition = m_reference->GetPosition();
-                }
-                
                 // Cache last valid position in m_point for fallback if reference becomes invalid
-                m_point = basePosition + offset;
+                m_point = reference.m_position + offset;
                 return m_point;
             }
             return m_point;  // Return cached position if reference is null/invalid
         }
        
         bool IsNearlyEqual(const TranslationPoint& other) const {
-            RE::NiPoint3 pos = GetPoint();
-            RE::NiPoint3 otherPos = other.GetPoint();
-            return std::abs(pos.x - otherPos.x) < EPSILON_COMPARISON &&
-                   std::abs(pos.y - otherPos.y) < EPSILON_COMPARISON &&
-                   std::abs(pos.z - otherPos.z) < EPSILON_COMPARISON;
+            return ValuesNearlyEqual(GetPoint(), other.GetPoint());
         }
        
         TranslationPoint LinearInterpolate(const TranslationPoint& p1, const TranslationPoint& p2, float t) const {
             TranslationPoint result;
             result.m_transition = m_transition;
-            
-            auto pt1 = p1.GetPoint();
-            auto pt2 = p2.GetPoint();
-            
-            result.m_point.x = pt1.x + t * (pt2.x - pt1.x);
-            result.m_point.y = pt1.y + t * (pt2.y - pt1.y);
-            result.m_point.z = pt1.z + t * (pt2.z - pt1.z);
-            
+            result.m_point = InterpolateLinear(p1.GetPoint(), p2.GetPoint(), t);
             return result;
         }
         
@@ -144,17 +107,61 @@ namespace FCFW {
                                    const TranslationPoint& p2, const TranslationPoint& p3, float t) const {
             TranslationPoint result;
             result.m_transition = m_transition;
+            result.m_point = InterpolateCubic(p0.GetPoint(), p1.GetPoint(), p2.GetPoint(), p3.GetPoint(), t);
+            return result;
+        }
 
-            auto pt0 = p0.GetPoint();
-            auto pt1 = p1.GetPoint();
-            auto pt2 = p2.GetPoint();
-            auto pt3 = p3.GetPoint();
+        // Value-level kernels (used directly on CameraPath column storage)
+        static bool ValuesNearlyEqual(const RE::NiPoint3& a, const RE::NiPoint3& b) {
+            return std::abs(a.x - b.x) < EPSILON_COMPARISON &&
+                   std::abs(a.y - b.y) < EPSILON_COMPARISON &&
+                   std::abs(a.z - b.z) < EPSILON_COMPARISON;
+        }
 
-            result.m_point.x = CubicHermiteInterpolate(pt0.x, pt1.x, pt2.x, pt3.x, t);
-            result.m_point.y = CubicHermiteInterpolate(pt0.y, pt1.y, pt2.y, pt3.y, t);
-            result.m_point.z = CubicHermiteInterpolate(pt0.z, pt1.z, pt2.z, pt3.z, t);
+        static RE::NiPoint3 InterpolateLinear(const RE::NiPoint3& pt1, const RE::NiPoint3& pt2, float t) {
+            return RE::NiPoint3{
+                pt1.x + t * (pt2.x - pt1.x),
+                pt1.y + t * (pt2.y - pt1.y),
+                pt1.z + t * (pt2.z - pt1.z)};
+        }
 
-            return result;
+        static RE::NiPoint3 InterpolateCubic(const RE::NiPoint3& pt0, const RE::NiPoint3& pt1,
+                                             const RE::NiPoint3& pt2, const RE::NiPoint3& pt3, float t) {
+            return RE::NiPoint3{
+                CubicHermiteInterpolate(pt0.x, pt1.x, pt2.x, pt3.x, t),
+                CubicHermiteInterpolate(pt0.y, pt1.y, pt2.y, pt3.y, t),
+                CubicHermiteInterpolate(pt0.z, pt1.z, pt2.z, pt3.z, t)};
+        }
+
+        static SegmentCoefficients ComputeSegmentCoefficients(const RE::NiPoint3& p0, const RE::NiPoint3& p1,
+                                                              const RE::NiPoint3& p2, const RE::NiPoint3& p3) {
+            return {
+                ComputeCubicHermiteCoefficients(p0.x, p1.x, p2.x, p3.x),
+                ComputeCubicHermiteCoefficients(p0.y, p1.y, p2.y, p3.y),
+                ComputeCubicHermiteCoefficients(p0.z, p1.z, p2.z, p3.z)};
+        }
+
+        static RE::NiPoint3 EvaluateSegment(const SegmentCoefficients& a_coefficients, float t) {
+            return RE::NiPoint3{a_coefficients[0].Evaluate(t), a_coefficients[1].Evaluate(t), a_coefficients[2].Evaluate(t)};
+        }
+
+        static SegmentCoefficients ComputeLinearCoefficients(const RE::NiPoint3& pt1, const RE::NiPoint3& pt2) {
+            return {
+                CubicCoefficients{0.0f, 0.0f, pt2.x - pt1.x, pt1.x},
+                CubicCoefficients{0.0f, 0.0f, pt2.y - pt1.y, pt1.y},
+                CubicCoefficients{0.0f, 0.0f, pt2.z - pt1.z, pt1.z}};
+        }
+
+        static RE::NiPoint3 ValueFromChannels(const float* a_channels) {
+            return RE::NiPoint3{a_channels[0], a_channels[1], a_channels[2]};
+        }
+
+        // Scalar axes of a channelized path (x, y, z), see ScalarChannel
+        static constexpr size_t kAxisCount = 3;
+        static constexpr bool kAxesAreAngles = false;
+
+        static RE::NiPoint3 ValueFromAxes(const float* a_axes) {
+            return RE::NiPoint3{a_axes[0], a_axes[1], a_axes[2]};
         }
        
         TranslationPoint operator+(const TranslationPoint& other) const {
@@ -180,6 +187,9 @@ namespace FCFW {
 
     class RotationPoint {
     public:
+        using ValueType = RE::NiPoint3;
+        using SegmentCoefficients = std::array<CubicCoefficients, 4>;  // quaternion w, x, y, z
+
         RotationPoint(
             const Transition& a_transition = Transition(0.0f, InterpolationMode::kCubicHermite, false, false),
             PointType a_pointType = PointType::kWorld,
@@ -203,57 +213,25 @@ namespace FCFW {
         }
 
         RE::NiPoint3 GetPoint() const {
-            if (m_pointType == PointType::kReference && m_reference && m_reference->Is3DLoaded()) {
+            if (m_pointType == PointType::kReference && m_reference) {
+                const ResolvedReference reference = ReferenceCache::Resolve(m_reference, m_bodyPart, m_isOffsetRelative);
+                if (!reference.m_isLoaded) {
+                    return m_point;
+                }
+
                 if (m_isOffsetRelative) { // If offset is relative to reference heading, use reference's facing direction
-                    float pitch = 0.0f;
-                    float roll = 0.0f;
-                    float yaw = 0.0f;
-                    RE::Actor* actor = m_reference->As<RE::Actor>();
-                    
-                    // If bodyPart is specified and reference is an actor, try to get rotation from body part
-                    if (m_bodyPart != BodyPart::kNone && actor) {
-                        auto targetPoint = _ts_SKSEFunctions::GetTargetPoint(actor, BodyPartToLimbEnum(m_bodyPart));
-                        if (targetPoint) {
-                            // Extract rotation from body part node
-                            auto rotation = _ts_SKSEFunctions::GetBodyPartRotation(actor, BodyPartToLimbEnum(m_bodyPart));
-                            pitch = rotation.x;
-                            roll = rotation.y;
-                            yaw = rotation.z;
-                        } else {
-                            // Fallback to actor root rotation
-                            yaw = actor->GetHeading(false);
-                        }
-                    } else if (actor) {
-                        // No body part specified, use actor heading
-                        yaw = actor->GetHeading(false);
-                    } else {
-                        // Not an actor, use reference angles
-                        pitch = m_reference->GetAngleX();
-                        roll = m_reference->GetAngleY();
-                        yaw = m_reference->GetAngleZ();
-                    }
+                    // Body part rotation, actor heading or reference angles
+                    const RE::NiPoint3& rotation = reference.m_rotation;
                     
                     // Apply offset to reference's base orientation and cache (pitch, roll, yaw)
                     m_point = RE::NiPoint3{
-                        _ts_SKSEFunctions::NormalRelativeAngle(pitch + m_offset.x),
-                        _ts_SKSEFunctions::NormalRelativeAngle(roll + m_offset.y),
-                        _ts_SKSEFunctions::NormalRelativeAngle(yaw + m_offset.z)};
+                        _ts_SKSEFunctions::NormalRelativeAngle(rotation.x + m_offset.x),
+                        _ts_SKSEFunctions::NormalRelativeAngle(rotation.y + m_offset.y),
+                        _ts_SKSEFunctions::NormalRelativeAngle(rotation.z + m_offset.z)};
                     return m_point;
                 } else { // camera looks at reference with offset
-                    // Get target position (body part if specified for actors, otherwise root position)
-                    RE::NiPoint3 refPos;
-                    RE::Actor* actor = m_reference->As<RE::Actor>();
-                    if (m_bodyPart != BodyPart::kNone && actor) {
-                        auto targetPoint = _ts_SKSEFunctions::GetTargetPoint(actor, BodyPartToLimbEnum(m_bodyPart));
-                        if (targetPoint) {
-                            refPos = targetPoint->world.translate;
-                        } else {
-                            // Fallback to root position if target point not found
-                            refPos = m_reference->GetPosition();
-                        }
-                    } else {
-                        refPos = m_reference->GetPosition();
-                    }
+                    // Target position (body part if specified for actors, otherwise root position)
+                    const RE::NiPoint3& refPos = reference.m_position;
                     
                     RE::NiPoint3 cameraPos = _ts_SKSEFunctions::GetCameraPos();
                     
@@ -339,30 +317,13 @@ namespace FCFW {
         }
        
         bool IsNearlyEqual(const RotationPoint& other) const {
-            RE::NiPoint3 rot = GetPoint();
-            RE::NiPoint3 otherRot = other.GetPoint();
-            return std::abs(rot.x - otherRot.x) < EPSILON_COMPARISON &&
-                   std::abs(rot.y - otherRot.y) < EPSILON_COMPARISON &&
-                   std::abs(rot.z - otherRot.z) < EPSILON_COMPARISON;
+            return ValuesNearlyEqual(GetPoint(), other.GetPoint());
         }
 
         RotationPoint LinearInterpolate(const RotationPoint& p1, const RotationPoint& p2, float t) const {
             RotationPoint result;
             result.m_transition = m_transition;
-            
-            auto pt1 = p1.GetPoint();
-            auto pt2 = p2.GetPoint();
-            
-            // Calculate angular deltas with wrapping (pitch, roll, yaw)
-            float pitchDelta = _ts_SKSEFunctions::NormalRelativeAngle(pt2.x - pt1.x);
-            float rollDelta = _ts_SKSEFunctions::NormalRelativeAngle(pt2.y - pt1.y);
-            float yawDelta = _ts_SKSEFunctions::NormalRelativeAngle(pt2.z - pt1.z);
-            
-            // Interpolate and normalize result
-            result.m_point.x = _ts_SKSEFunctions::NormalRelativeAngle(pt1.x + t * pitchDelta);
-            result.m_point.y = _ts_SKSEFunctions::NormalRelativeAngle(pt1.y + t * rollDelta);
-            result.m_point.z = _ts_SKSEFunctions::NormalRelativeAngle(pt1.z + t * yawDelta);
-            
+            result.m_point = InterpolateLinear(p1.GetPoint(), p2.GetPoint(), t);
             return result;
         }
         
@@ -370,17 +331,56 @@ namespace FCFW {
                                    const RotationPoint& p2, const RotationPoint& p3, float t) const {
             RotationPoint result;
             result.m_transition = m_transition;
+            result.m_point = InterpolateCubic(p0.GetPoint(), p1.GetPoint(), p2.GetPoint(), p3.GetPoint(), t);
+            return result;
+        }
+
+        // Value-level kernels (used directly on CameraPath column storage)
+        static bool ValuesNearlyEqual(const RE::NiPoint3& a, const RE::NiPoint3& b) {
+            return std::abs(a.x - b.x) < EPSILON_COMPARISON &&
+                   std::abs(a.y - b.y) < EPSILON_COMPARISON &&
+                   std::abs(a.z - b.z) < EPSILON_COMPARISON;
+        }
 
-            auto pt0 = p0.GetPoint();
-            auto pt1 = p1.GetPoint();
-            auto pt2 = p2.GetPoint();
-            auto pt3 = p3.GetPoint();
+        // Rotations are interpolated as quaternions (no per-axis wrapping or gimbal artifacts)
+        // and converted back to pitch/roll/yaw for the camera
+        static RE::NiPoint3 InterpolateLinear(const RE::NiPoint3& pt1, const RE::NiPoint3& pt2, float t) {
+            return EvaluateSegment(ComputeLinearCoefficients(pt1, pt2), t);
+        }
 
-            result.m_point.x = CubicHermiteInterpolateAngular(pt0.x, pt1.x, pt2.x, pt3.x, t);
-            result.m_point.y = CubicHermiteInterpolateAngular(pt0.y, pt1.y, pt2.y, pt3.y, t);
-            result.m_point.z = CubicHermiteInterpolateAngular(pt0.z, pt1.z, pt2.z, pt3.z, t);
+        static RE::NiPoint3 InterpolateCubic(const RE::NiPoint3& pt0, const RE::NiPoint3& pt1,
+                                             const RE::NiPoint3& pt2, const RE::NiPoint3& pt3, float t) {
+            return EvaluateSegment(ComputeSegmentCoefficients(pt0, pt1, pt2, pt3), t);
+        }
 
-            return result;
+        static SegmentCoefficients ComputeSegmentCoefficients(const RE::NiPoint3& p0, const RE::NiPoint3& p1,
+                                                              const RE::NiPoint3& p2, const RE::NiPoint3& p3) {
+            return ComputeQuaternionHermiteCoefficients(
+                EulerToQuaternion(p0), EulerToQuaternion(p1), EulerToQuaternion(p2), EulerToQuaternion(p3));
+        }
+
+        static RE::NiPoint3 EvaluateSegment(const SegmentCoefficients& a_coefficients, float t) {
+            const float channels[4] = {
+                a_coefficients[0].Evaluate(t), a_coefficients[1].Evaluate(t),
+                a_coefficients[2].Evaluate(t), a_coefficients[3].Evaluate(t)};
+            return ValueFromChannels(channels);
+        }
+
+        static SegmentCoefficients ComputeLinearCoefficients(const RE::NiPoint3& pt1, const RE::NiPoint3& pt2) {
+            return ComputeQuaternionSlerpCoefficients(EulerToQuaternion(pt1), EulerToQuaternion(pt2));
+        }
+
+        static RE::NiPoint3 ValueFromChannels(const float* a_channels) {
+            return QuaternionToEuler(Quaternion{ a_channels[0], a_channels[1], a_channels[2], a_channels[3] });
+        }
+
+        // Scalar axes of a channelized path (pitch, roll, yaw), see ScalarChannel. Each axis is interpolated on
+        // its own along the shortest arc, so sparse rotation channels are Euler curves rather than quaternion ones.
+        static constexpr size_t kAxisCount = 3;
+        static constexpr bool kAxesAreAngles = true;
+
+        static RE::NiPoint3 ValueFromAxes(const float* a_axes) {
+            return RE::NiPoint3{a_axes[0], a_axes[1], a_axes[2]};
         }
 
         // Raw arithmetic operators - DO NOT wrap (needed for unwrapped space calculations)
@@ -419,6 +419,9 @@ namespace FCFW {
 
     class FOVPoint {
     public:
+        using ValueType = float;
+        using SegmentCoefficients = std::array<CubicCoefficients, 1>;
+
         FOVPoint(
             const Transition& a_transition = Transition(0.0f, InterpolationMode::kCubicHermite, false, false),
             float a_fov = 80.0f)
@@ -442,13 +445,13 @@ namespace FCFW {
         }
 
         bool IsNearlyEqual(const FOVPoint& other) const {
-            return std::abs(m_point - other.m_point) < EPSILON_COMPARISON;
+            return ValuesNearlyEqual(m_point, other.m_point);
         }
 
         FOVPoint LinearInterpolate(const FOVPoint& p1, const FOVPoint& p2, float t) const {
             FOVPoint result;
             result.m_transition = m_transition;
-            result.m_point = p1.m_point + t * (p2.m_point - p1.m_point);
+            result.m_point = InterpolateLinear(p1.m_point, p2.m_point, t);
             return result;
         }
 
@@ -456,10 +459,47 @@ namespace FCFW {
                               const FOVPoint& p2, const FOVPoint& p3, float t) const {
             FOVPoint result;
             result.m_transition = m_transition;
-            result.m_point = CubicHermiteInterpolate(p0.m_point, p1.m_point, p2.m_point, p3.m_point, t);
+            result.m_point = InterpolateCubic(p0.m_point, p1.m_point, p2.m_point, p3.m_point, t);
             return result;
         }
 
+        // Value-level kernels (used directly on CameraPath column storage)
+        static bool ValuesNearlyEqual(float a, float b) {
+            return std::abs(a - b) < EPSILON_COMPARISON;
+        }
+
+        static float InterpolateLinear(float p1, float p2, float t) {
+            return p1 + t * (p2 - p1);
+        }
+
+        static float InterpolateCubic(float p0, float p1, float p2, float p3, float t) {
+            return CubicHermiteInterpolate(p0, p1, p2, p3, t);
+        }
+
+        static SegmentCoefficients ComputeSegmentCoefficients(float p0, float p1, float p2, float p3) {
+            return {ComputeCubicHermiteCoefficients(p0, p1, p2, p3)};
+        }
+
+        static float EvaluateSegment(const SegmentCoefficients& a_coefficients, float t) {
+            return a_coefficients[0].Evaluate(t);
+        }
+
+        static SegmentCoefficients ComputeLinearCoefficients(float p1, float p2) {
+            return {CubicCoefficients{0.0f, 0.0f, p2 - p1, p1}};
+        }
+
+        static float ValueFromChannels(const float* a_channels) {
+            return a_channels[0];
+        }
+
+        // FOV is a single scalar already (axis count for template compatibility)
+        static constexpr size_t kAxisCount = 1;
+        static constexpr bool kAxesAreAngles = false;
+
+        static float ValueFromAxes(const float* a_axes) {
+            return a_axes[0];
+        }
+
         FOVPoint operator+(const FOVPoint& other) const {
             return FOVPoint(m_transition, m_point + other.m_point);
         }
@@ -478,6 +518,53 @@ namespace FCFW {
         RE::TESObjectREFR* m_reference;  // Always nullptr (dummy for template compatibility)
     };
 
+    // Key list of one scalar axis of a channelized path (see CameraPath::AddChannels). A channel without keys is a
+    // constant. Segments follow the track rules: the mode comes from the end key, easing from the key the segment
+    // interpolates to, cubic neighbours clamp at the ends (end mode) or wrap around (loop mode).
+    class ScalarChannel {
+    public:
+        struct Key {
+            Transition m_transition;
+            float m_value;
+        };
+
+        ScalarChannel() = default;
+        explicit ScalarChannel(float a_constant) : m_constant(a_constant) {}
+
+        // Sorted insert (before keys with the same time, like CameraPath::AddPoint); negative times are clamped to 0
+        void AddKey(const Key& a_key);
+        bool IsKeyed() const { return !m_keys.empty(); }
+        const std::vector<Key>& GetKeys() const { return m_keys; }
+
+        float GetConstant() const { return m_constant; }
+        void SetConstant(float a_constant) { m_constant = a_constant; }
+
+        // Angle channels (radians) interpolate along the shortest arc and return normalized values
+        void SetAngle(bool a_isAngle) { m_isAngle = a_isAngle; }
+
+        // Value at a_time. In loop mode the virtual segment runs from the last key back to the first key and
+        // ends at a_loopEnd; a_loopEnd <= last key time means there is no virtual segment.
+        float Evaluate(float a_time, bool a_loop, float a_loopEnd) const;
+
+        // Moves every key through a non-decreasing time mapping
+        template <typename TimeMap>
+        void RemapTimes(TimeMap&& a_map) {
+            for (size_t i = 0; i < m_keys.size(); ++i) {
+                float& time = m_keys[i].m_transition.m_time;
+                time = std::max(a_map(time), i > 0 ? m_keys[i - 1].m_transition.m_time : 0.0f);
+            }
+            m_cursor = 0;
+        }
+
+    private:
+        size_t FindKey(float a_time) const;
+
+        std::vector<Key> m_keys;        // sorted by time
+        float m_constant{ 0.0f };       // value while the channel has no keys
+        bool m_isAngle{ false };
+        mutable size_t m_cursor{ 0 };   // key found by the last lookup (playback locality hint)
+    };
+
     template<typename TransitionPoint>
     class CameraPath {
     public:
@@ -488,63 +575,527 @@ namespace FCFW {
         template<typename PointType, typename PathType>
         friend bool ExportPathToYAML(const PathType* path, std::ofstream& a_file, float a_conversionFactor);
         
+        using ValueType = typename TransitionPoint::ValueType;
+
+        // Cubic Hermite or linear segment with fixed control points, reduced to polynomial coefficients
+        struct HermiteSegment {
+            enum class State : std::uint8_t {
+                kInvalid,  // not built yet (or invalidated by an edit)
+                kCached,   // coefficients valid
+                kDynamic   // touches a kReference point, must be evaluated every frame
+            };
+
+            typename TransitionPoint::SegmentCoefficients m_coefficients{};
+            ValueType m_constantValue{};  // used instead of the polynomial when start and end point are nearly equal
+            bool m_isConstant{ false };
+            State m_state{ State::kInvalid };
+        };
+
+        // Movable, so finished paths can be swapped into a timeline cheaply (see Timeline::SwapPoints)
+        CameraPath() = default;
+        CameraPath(const CameraPath&) = default;
+        CameraPath(CameraPath&&) noexcept = default;
+        CameraPath& operator=(const CameraPath&) = default;
+        CameraPath& operator=(CameraPath&&) noexcept = default;
         virtual ~CameraPath() = default;
                 
         size_t AddPoint(const TransitionPoint& a_point) {
-            TransitionPoint modifiedPoint = a_point;
-            if (modifiedPoint.m_transition.m_time < 0.0f) {
-                modifiedPoint.m_transition.m_time = 0.0f;
+            m_channels.reset();  // point edits turn a channelized path into regular keys (see AddChannels)
+
+            float time = a_point.m_transition.m_time;
+            if (time < 0.0f) {
+                time = 0.0f;
             } 
 
             // Insert point in sorted order by time
-            auto insertPos = std::lower_bound(m_points.begin(), m_points.end(), modifiedPoint.m_transition.m_time,
-                [](const TransitionPoint& point, float time) {
-                    return point.m_transition.m_time < time;
+            size_t index = FindSegmentIndex(time);
+            m_times.insert(m_times.begin() + index, time);
+            m_values.insert(m_values.begin() + index, a_point.m_point);
+            m_flags.insert(m_flags.begin() + index, PackFlags(a_point.m_transition.m_mode, a_point.m_transition.m_easeIn,
+                                                              a_point.m_transition.m_easeOut, a_point.m_pointType));
+
+            // Shift side table entries behind the new point, then add its metadata if it has any
+            auto metadataPos = std::lower_bound(m_metadata.begin(), m_metadata.end(), index,
+                [](const PointMetadata& metadata, size_t pointIndex) {
+                    return metadata.m_pointIndex < pointIndex;
                 });
-            
-            auto it = m_points.insert(insertPos, modifiedPoint);
-            return std::distance(m_points.begin(), it);
+            for (auto it = metadataPos; it != m_metadata.end(); ++it) {
+                ++it->m_pointIndex;
+            }
+            if constexpr (kHasMetadata) {
+                PointMetadata metadata{index, a_point.m_reference, a_point.m_offset, a_point.m_isOffsetRelative, a_point.m_bodyPart};
+                if (!metadata.IsDefault()) {
+                    m_metadata.insert(metadataPos, metadata);
+                }
+            }
+
+            // Segment slots are keyed by their end point, so shift them along with the points
+            if (m_segmentCache.size() == m_times.size()) {
+                m_segmentCache.insert(m_segmentCache.begin() + index, HermiteSegment{});
+            }
+            InvalidateSegmentsAround(index);
+            return index;
+        }
+
+        // Same result as calling AddPoint for each point in order, as one merge of the sorted batch into the
+        // columns. The segment cache is rebuilt lazily.
+        void AddPoints(std::span<const TransitionPoint> a_points) {
+            if (a_points.empty()) {
+                return;
+            }
+            m_channels.reset();
+
+            // (clamped time, batch index) pairs. AddPoint inserts before keys with the same time, so later batch
+            // points come first among equal times.
+            std::vector<std::pair<float, size_t>> order(a_points.size());
+            for (size_t i = 0; i < order.size(); ++i) {
+                order[i] = { std::max(a_points[i].m_transition.m_time, 0.0f), i };
+            }
+            std::sort(order.begin(), order.end(), [](const auto& a_lhs, const auto& a_rhs) {
+                return a_lhs.first < a_rhs.first || (a_lhs.first == a_rhs.first && a_lhs.second > a_rhs.second);
+            });
+
+            const size_t count = m_times.size() + a_points.size();
+            std::vector<float> times;
+            std::vector<ValueType> values;
+            std::vector<std::uint8_t> flags;
+            std::vector<PointMetadata> metadata;
+            times.reserve(count);
+            values.reserve(count);
+            flags.reserve(count);
+            metadata.reserve(m_metadata.size());
+
+            size_t existing = 0;
+            size_t added = 0;
+            auto existingMetadata = m_metadata.begin();
+            while (times.size() < count) {
+                const size_t index = times.size();
+                if (added < order.size() && (existing == m_times.size() || order[added].first <= m_times[existing])) {
+                    const TransitionPoint& point = a_points[order[added].second];
+                    times.push_back(order[added++].first);
+                    values.push_back(point.m_point);
+                    flags.push_back(PackFlags(point.m_transition.m_mode, point.m_transition.m_easeIn, point.m_transition.m_easeOut, point.m_pointType));
+                    if constexpr (kHasMetadata) {
+                        PointMetadata pointMetadata{index, point.m_reference, point.m_offset, point.m_isOffsetRelative, point.m_bodyPart};
+                        if (!pointMetadata.IsDefault()) {
+                            metadata.push_back(pointMetadata);
+                        }
+                    }
+                } else {
+                    if (existingMetadata != m_metadata.end() && existingMetadata->m_pointIndex == existing) {
+                        metadata.push_back(*existingMetadata++);
+                        metadata.back().m_pointIndex = index;
+                    }
+                    times.push_back(m_times[existing]);
+                    values.push_back(m_values[existing]);
+                    flags.push_back(m_flags[existing]);
+                    ++existing;
+                }
+            }
+
+            m_times = std::move(times);
+            m_values = std::move(values);
+            m_flags = std::move(flags);
+            m_metadata = std::move(metadata);
+            m_segmentCache.clear();
         }
         
-        const TransitionPoint& GetPoint(size_t a_index) const {
-            if (a_index >= m_points.size()) {
+        // Returns a copy of the point assembled from the column storage.
+        // Reference-based points are resolved first, so m_point holds the current value.
+        // Breaking change: this used to return a const reference into the point vector. Callers that kept the
+        // reference must keep the returned copy instead; it does not follow later edits of the path.
+        TransitionPoint GetPoint(size_t a_index) const {
+            if (a_index >= m_times.size()) {
                 log::error("{}: index out of range", __FUNCTION__);
                 throw std::out_of_range("CameraPath::GetPoint: index out of range");
             }
             
-            // Update cached m_point from reference if this is a reference-based point
-            if (m_points[a_index].m_pointType == PointType::kReference && m_points[a_index].m_reference) {
-                m_points[a_index].m_point = m_points[a_index].GetPoint();
+            // Update cached value from reference if this is a reference-based point
+            if (GetPointType(a_index) == PointType::kReference) {
+                GetPointValue(a_index);
             }
             
-            return m_points[a_index];
+            return BuildPoint(a_index);
         }
         
         void RemovePoint(size_t a_index) {
-            if (a_index < m_points.size()) {
-                m_points.erase(m_points.begin() + a_index);
+            if (a_index < m_times.size()) {
+                m_channels.reset();
+                m_times.erase(m_times.begin() + a_index);
+                m_values.erase(m_values.begin() + a_index);
+                m_flags.erase(m_flags.begin() + a_index);
+
+                auto metadataPos = std::lower_bound(m_metadata.begin(), m_metadata.end(), a_index,
+                    [](const PointMetadata& metadata, size_t pointIndex) {
+                        return metadata.m_pointIndex < pointIndex;
+                    });
+                if (metadataPos != m_metadata.end() && metadataPos->m_pointIndex == a_index) {
+                    metadataPos = m_metadata.erase(metadataPos);
+                }
+                for (auto it = metadataPos; it != m_metadata.end(); ++it) {
+                    --it->m_pointIndex;
+                }
+
+                if (m_segmentCache.size() == m_times.size() + 2) {
+                    m_segmentCache.erase(m_segmentCache.begin() + a_index);
+                }
+                InvalidateSegmentsAround(a_index);
             }
         }
         
         void ClearPath() {
-            m_points.clear();
+            m_times.clear();
+            m_values.clear();
+            m_flags.clear();
+            m_metadata.clear();
+            m_segmentCache.clear();
+            m_channels.reset();
         }
         
-        size_t GetPointCount() const { return m_points.size(); }
+        size_t GetPointCount() const { return m_times.size(); }
+
+        // Move every point through a non-decreasing time mapping. Point order is kept and segment
+        // coefficients do not depend on key times, so the segment cache stays valid.
+        template <typename TimeMap>
+        void RemapTimes(TimeMap&& a_map) {
+            if (m_channels) {
+                for (auto& channel : *m_channels) {
+                    channel.RemapTimes(a_map);
+                }
+                RebuildChannelPoints();
+                return;
+            }
+            for (size_t i = 0; i < m_times.size(); ++i) {
+                m_times[i] = std::max(a_map(m_times[i]), i > 0 ? m_times[i - 1] : 0.0f);
+            }
+        }
 
-        // Update all camera points - store current camera value into m_point
+        // ===== Channelized paths =====
+        // Optional sparse form with one ScalarChannel per axis (x/y/z or pitch/roll/yaw): unkeyed axes are constants
+        // and keyed axes only interpolate between their own keys. The point columns mirror the channels as world
+        // points at the union of all key times, so counts, times, GetPoint and the clock range work unchanged;
+        // TimelineTrack evaluates through EvaluateChannels. A point edit turns the path into regular keys at those
+        // union times.
+        using ChannelSet = std::array<ScalarChannel, TransitionPoint::kAxisCount>;
+
+        bool IsChannelized() const { return m_channels.has_value(); }
+        const ChannelSet* GetChannels() const { return m_channels ? &*m_channels : nullptr; }
+
+        // An empty path becomes channelized and a channelized path gets the keys merged in per axis (an unkeyed axis
+        // takes the incoming constant). A path with regular points gets a_channels added as points at the union times.
+        void AddChannels(const ChannelSet& a_channels) {
+            if (!m_channels && !m_times.empty()) {
+                const std::vector<float> times = CollectKeyTimes(a_channels);
+                for (size_t i = 0; i < times.size(); ++i) {
+                    AddPoint(BuildChannelPoint(a_channels, times, i));
+                }
+                return;
+            }
+
+            if (!m_channels) {
+                m_channels = a_channels;
+            } else {
+                for (size_t axis = 0; axis < TransitionPoint::kAxisCount; ++axis) {
+                    ScalarChannel& channel = (*m_channels)[axis];
+                    if (!channel.IsKeyed()) {
+                        channel.SetConstant(a_channels[axis].GetConstant());
+                    }
+                    for (const auto& key : a_channels[axis].GetKeys()) {
+                        channel.AddKey(key);
+                    }
+                }
+            }
+            for (auto& channel : *m_channels) {
+                channel.SetAngle(TransitionPoint::kAxesAreAngles);
+            }
+            RebuildChannelPoints();
+        }
+
+        ValueType EvaluateChannels(float a_time, bool a_loop, float a_loopEnd) const {
+            return EvaluateChannels(*m_channels, a_time, a_loop, a_loopEnd);
+        }
+
+        // Packed per-point flags: bits 0-1 interpolation mode, bit 2 ease in, bit 3 ease out, bits 4-5 point type
+        static constexpr std::uint8_t kModeMask = 0x03;
+        static constexpr std::uint8_t kEaseInFlag = 0x04;
+        static constexpr std::uint8_t kEaseOutFlag = 0x08;
+        static constexpr std::uint8_t kPointTypeShift = 4;
+
+        // Segment keys reuse the mode and ease bits of the flags and add the loop boundary handling
+        static constexpr std::uint8_t kLoopKeyFlag = 0x10;
+
+        // Per-point column accessors (no bounds checks, no object assembly)
+        float GetPointTime(size_t a_index) const { return m_times[a_index]; }
+        InterpolationMode GetPointMode(size_t a_index) const { return static_cast<InterpolationMode>(m_flags[a_index] & kModeMask); }
+        bool GetPointEaseIn(size_t a_index) const { return (m_flags[a_index] & kEaseInFlag) != 0; }
+        bool GetPointEaseOut(size_t a_index) const { return (m_flags[a_index] & kEaseOutFlag) != 0; }
+        PointType GetPointType(size_t a_index) const { return static_cast<PointType>(m_flags[a_index] >> kPointTypeShift); }
+
+        // Current value of a point. kReference points are re-resolved and the result is kept as
+        // fallback for when the reference becomes invalid.
+        ValueType GetPointValue(size_t a_index) const {
+            if (GetPointType(a_index) == PointType::kReference) {
+                if (const auto* metadata = FindMetadata(a_index); metadata && metadata->m_reference) {
+                    m_values[a_index] = BuildPoint(a_index).GetPoint();
+                }
+            }
+            return m_values[a_index];
+        }
+
+        // Key of the segment ending at point a_index (a_index == GetPointCount() is the virtual loop segment).
+        // The mode comes from the end point (last point for the virtual segment), easing from the point the
+        // segment interpolates to (point 0 for the virtual segment). Requires at least one point.
+        size_t GetSegmentKey(size_t a_index, bool a_loop) const {
+            const size_t modeIdx = std::min(a_index, m_times.size() - 1);
+            const size_t easeIdx = (a_loop && a_index == m_times.size()) ? 0 : modeIdx;
+            return (m_flags[modeIdx] & kModeMask) | (m_flags[easeIdx] & (kEaseInFlag | kEaseOutFlag)) |
+                   (a_loop ? kLoopKeyFlag : 0);
+        }
+
+        // Index of the first point with time >= a_time (GetPointCount() if a_time is past the last point)
+        size_t FindSegmentIndex(float a_time) const {
+            auto it = std::lower_bound(m_times.begin(), m_times.end(), a_time);
+            return static_cast<size_t>(std::distance(m_times.begin(), it));
+        }
+
+        // Control point indices (p0, p1, p2, p3) of the cubic segment ending at point a_index.
+        // a_index == GetPointCount() is the virtual loop segment (last point -> first point).
+        // Requires at least two points and a_index > 0 unless a_loop is set.
+        std::array<size_t, 4> GetHermiteControlIndices(size_t a_index, bool a_loop) const {
+            const size_t pointCount = m_times.size();
+            const size_t current = a_index % pointCount;
+            if (a_loop) {
+                // Loop mode: wrap all neighbours around
+                return {(current + pointCount - 2) % pointCount, (current + pointCount - 1) % pointCount,
+                        current, (current + 1) % pointCount};
+            }
+            // End mode: clamp neighbours at the boundaries
+            return {current >= 2 ? current - 2 : current - 1, current - 1, current,
+                    current + 1 < pointCount ? current + 1 : current};
+        }
+
+        // Cached coefficients of the segment ending at point a_index (see GetHermiteControlIndices), cubic or
+        // linear depending on the segment's interpolation mode. Built lazily on first use.
+        // Returns nullptr for segments that touch a kReference point.
+        const HermiteSegment* GetHermiteSegment(size_t a_index, bool a_loop) const {
+            if (m_times.size() < 2 || a_index > m_times.size()) {
+                return nullptr;
+            }
+
+            // Neighbour selection differs between loop and end mode
+            if (a_loop != m_segmentCacheLoop || m_segmentCache.size() != m_times.size() + 1) {
+                m_segmentCache.assign(m_times.size() + 1, HermiteSegment{});
+                m_segmentCacheLoop = a_loop;
+            }
+
+            HermiteSegment& segment = m_segmentCache[a_index];
+            if (segment.m_state == HermiteSegment::State::kInvalid) {
+                BuildHermiteSegment(a_index, a_loop, segment);
+            }
+            return segment.m_state == HermiteSegment::State::kCached ? &segment : nullptr;
+        }
+
+        // Update all camera points - store current camera value
         virtual void UpdateCameraPoints() {
-            for (auto& point : m_points) {
-                if (point.m_pointType == PointType::kCamera) {
-                    point.m_point = point.GetPointAtCamera();
+            for (size_t i = 0; i < m_times.size(); ++i) {
+                if (GetPointType(i) == PointType::kCamera) {
+                    m_values[i] = BuildPoint(i).GetPointAtCamera();
                 }
             }
+            m_segmentCache.clear();  // camera values feed into cached segments
         }
 
         virtual TransitionPoint GetPointAtCamera(float a_time, bool a_easeIn, bool a_easeOut) const = 0;
         
     protected:
-        std::vector<TransitionPoint> m_points;
+        // Assemble a point object from the columns without resolving references
+        TransitionPoint BuildPoint(size_t a_index) const {
+            TransitionPoint point;
+            point.m_transition = Transition(m_times[a_index], GetPointMode(a_index), GetPointEaseIn(a_index), GetPointEaseOut(a_index));
+            point.m_point = m_values[a_index];
+            point.m_pointType = GetPointType(a_index);
+            if constexpr (kHasMetadata) {
+                if (const auto* metadata = FindMetadata(a_index)) {
+                    point.m_reference = metadata->m_reference;
+                    point.m_offset = metadata->m_offset;
+                    point.m_isOffsetRelative = metadata->m_isOffsetRelative;
+                    point.m_bodyPart = metadata->m_bodyPart;
+                }
+            }
+            return point;
+        }
+
+    private:
+        static std::uint8_t PackFlags(InterpolationMode a_mode, bool a_easeIn, bool a_easeOut, PointType a_pointType) {
+            return static_cast<std::uint8_t>((static_cast<std::uint8_t>(a_mode) & kModeMask) |
+                                             (a_easeIn ? kEaseInFlag : 0) | (a_easeOut ? kEaseOutFlag : 0) |
+                                             (static_cast<std::uint8_t>(a_pointType) << kPointTypeShift));
+        }
+
+        // Point types with reference/offset data (translation and rotation, not FOV)
+        static constexpr bool kHasMetadata = requires(TransitionPoint a_point) {
+            a_point.m_offset;
+            a_point.m_bodyPart;
+        };
+
+        // Reference metadata, only stored for points that use it (kReference and kCamera points)
+        struct PointMetadata {
+            size_t m_pointIndex;
+            RE::TESObjectREFR* m_reference{ nullptr };
+            ValueType m_offset{};
+            bool m_isOffsetRelative{ false };
+            BodyPart m_bodyPart{ BodyPart::kNone };
+
+            bool IsDefault() const {
+                return !m_reference && m_offset == ValueType{} && !m_isOffsetRelative && m_bodyPart == BodyPart::kNone;
+            }
+        };
+
+        static ValueType EvaluateChannels(const ChannelSet& a_channels, float a_time, bool a_loop, float a_loopEnd) {
+            float axes[TransitionPoint::kAxisCount];
+            for (size_t axis = 0; axis < TransitionPoint::kAxisCount; ++axis) {
+                axes[axis] = a_channels[axis].Evaluate(a_time, a_loop, a_loopEnd);
+            }
+            return TransitionPoint::ValueFromAxes(axes);
+        }
+
+        // Sorted union of the key times. A time keyed several times on one axis (a step) appears as often
+        // as on the axis that repeats it most.
+        static std::vector<float> CollectKeyTimes(const ChannelSet& a_channels) {
+            std::vector<float> times;
+            std::vector<float> keyTimes;
+            std::vector<float> merged;
+            for (const auto& channel : a_channels) {
+                keyTimes.clear();
+                for (const auto& key : channel.GetKeys()) {
+                    keyTimes.push_back(key.m_transition.m_time);
+                }
+                merged.clear();
+                std::set_union(times.begin(), times.end(), keyTimes.begin(), keyTimes.end(), std::back_inserter(merged));
+                times.swap(merged);
+            }
+            return times;
+        }
+
+        // World point mirroring the channels at a_times[a_index]. Repeated times take each axis's n-th key at
+        // that time (its last one if it has fewer), axes without a key there are evaluated. Mode and easing
+        // come from the first axis with a matching key.
+        static TransitionPoint BuildChannelPoint(const ChannelSet& a_channels, const std::vector<float>& a_times, size_t a_index) {
+            const float time = a_times[a_index];
+            const size_t occurrence = a_index - static_cast<size_t>(std::lower_bound(a_times.begin(), a_times.end(), time) - a_times.begin());
+
+            TransitionPoint point;
+            point.m_transition = Transition(time, InterpolationMode::kCubicHermite, false, false);
+            point.m_pointType = PointType::kWorld;
+            float axes[TransitionPoint::kAxisCount];
+            bool hasTransition = false;
+            for (size_t axis = 0; axis < TransitionPoint::kAxisCount; ++axis) {
+                const auto& keys = a_channels[axis].GetKeys();
+                auto first = std::lower_bound(keys.begin(), keys.end(), time,
+                    [](const ScalarChannel::Key& a_key, float a_time) {
+                        return a_key.m_transition.m_time < a_time;
+                    });
+                auto last = std::upper_bound(first, keys.end(), time,
+                    [](float a_time, const ScalarChannel::Key& a_key) {
+                        return a_time < a_key.m_transition.m_time;
+                    });
+                if (first == last) {
+                    axes[axis] = a_channels[axis].Evaluate(time, false, 0.0f);
+                    continue;
+                }
+                const bool hasOccurrence = static_cast<size_t>(last - first) > occurrence;
+                const auto& key = hasOccurrence ? first[occurrence] : *(last - 1);
+                axes[axis] = key.m_value;
+                if (!hasTransition && hasOccurrence) {
+                    point.m_transition = key.m_transition;
+                    hasTransition = true;
+                }
+            }
+            point.m_point = TransitionPoint::ValueFromAxes(axes);
+            return point;
+        }
+
+        // Refill the point columns from the channels (world points at the union of the key times)
+        void RebuildChannelPoints() {
+            const std::vector<float> times = CollectKeyTimes(*m_channels);
+            m_times = times;
+            m_values.resize(times.size());
+            m_flags.resize(times.size());
+            m_metadata.clear();
+            m_segmentCache.clear();
+            for (size_t i = 0; i < times.size(); ++i) {
+                const TransitionPoint point = BuildChannelPoint(*m_channels, times, i);
+                m_values[i] = point.m_point;
+                m_flags[i] = PackFlags(point.m_transition.m_mode, point.m_transition.m_easeIn, point.m_transition.m_easeOut, PointType::kWorld);
+            }
+        }
+
+        const PointMetadata* FindMetadata(size_t a_index) const {
+            auto it = std::lower_bound(m_metadata.begin(), m_metadata.end(), a_index,
+                [](const PointMetadata& metadata, size_t pointIndex) {
+                    return metadata.m_pointIndex < pointIndex;
+                });
+            return (it != m_metadata.end() && it->m_pointIndex == a_index) ? &*it : nullptr;
+        }
+
+        void BuildHermiteSegment(size_t a_index, bool a_loop, HermiteSegment& a_segment) const {
+            // Same mode selection as TimelineTrack::GetInterpolatedPoint (virtual loop segment uses the last point)
+            const bool isCubic = GetPointMode(std::min(a_index, m_times.size() - 1)) == InterpolationMode::kCubicHermite;
+            auto indices = GetHermiteControlIndices(a_index, a_loop);
+            const size_t firstControl = isCubic ? 0 : 1;
+            const size_t lastControl = isCubic ? 3 : 2;
+            for (size_t i = firstControl; i <= lastControl; ++i) {
+                if (GetPointType(indices[i]) == PointType::kReference) {
+                    a_segment.m_state = HermiteSegment::State::kDynamic;
+                    return;
+                }
+            }
+
+            const ValueType& prevValue = m_values[indices[1]];
+            const ValueType& currentValue = m_values[indices[2]];
+            a_segment.m_isConstant = TransitionPoint::ValuesNearlyEqual(prevValue, currentValue);
+            if (a_segment.m_isConstant) {
+                a_segment.m_constantValue = isCubic ? prevValue : currentValue;
+            } else if (isCubic) {
+                a_segment.m_coefficients = TransitionPoint::ComputeSegmentCoefficients(
+                    m_values[indices[0]], prevValue, currentValue, m_values[indices[3]]);
+            } else {
+                a_segment.m_coefficients = TransitionPoint::ComputeLinearCoefficients(prevValue, currentValue);
+            }
+            a_segment.m_state = HermiteSegment::State::kCached;
+        }
+
+        // An edit at point a_index changes the segments using it as a control point (a_index - 1 .. a_index + 2)
+        // plus the loop wrap segments, which reference the first and last points
+        void InvalidateSegmentsAround(size_t a_index) {
+            if (m_segmentCache.size() != m_times.size() + 1) {
+                m_segmentCache.clear();  // out of sync, rebuild lazily
+                return;
+            }
+            auto invalidate = [this](size_t a_slot) {
+                if (a_slot < m_segmentCache.size()) {
+                    m_segmentCache[a_slot] = HermiteSegment{};
+                }
+            };
+            for (size_t slot = a_index > 0 ? a_index - 1 : 0; slot <= a_index + 2; ++slot) {
+                invalidate(slot);
+            }
+            const size_t virtualSlot = m_times.size();
+            invalidate(1);
+            invalidate(virtualSlot - 1);
+            invalidate(virtualSlot);
+        }
+
+        // Column storage: hot data (times, values, flags) is contiguous, reference metadata is sparse
+        std::vector<float> m_times;                 // key times, sorted ascending
+        mutable std::vector<ValueType> m_values;    // world value, baked camera value, or last resolved reference value
+        std::vector<std::uint8_t> m_flags;          // packed mode / ease / point type (see PackFlags)
+        std::vector<PointMetadata> m_metadata;      // sorted by m_pointIndex
+
+        mutable std::vector<HermiteSegment> m_segmentCache;  // indexed by segment end point, last slot = virtual loop segment
+        mutable bool m_segmentCacheLoop{ false };              // playback mode the cache was built for
+
+        std::optional<ChannelSet> m_channels;  // set for channelized paths, the columns then mirror it
     };
 
     class TranslationPath : public CameraPath<TranslationPoint> {
@@ -1,5 +1,6 @@
 #pragma once
 #include <functional>
+#include <span>
 #include <stdint.h>
 
 /*
@@ -31,7 +32,8 @@ namespace FCFW_API {
 
 	// SKSE Messaging Interface - Timeline Event Types
 	// Consumers can register a listener with SKSE::GetMessagingInterface()->RegisterListener()
-	// and receive these messages from FCFW
+	// and receive these messages from FCFW. Messages are sent after the triggering call has released FCFW's locks,
+	// so a handler may call back into the API (e.g. start the next timeline from kPlaybackStop)
 	enum class FCFWMessage : uint32_t {
 		// Dispatched when timeline playback starts
 		// Data: FCFWTimelineEventData*
@@ -52,9 +54,108 @@ namespace FCFW_API {
 		size_t timelineID;  // ID of the timeline that triggered the event
 	};
 
+	// Per-frame update stages timed by the frame profiler (see GetFrameStageStats)
+	enum class FrameStage : int {
+		kUpdate = 0,           // Whole per-frame update, lock wait included
+		kLockWait = 1,         // Waiting for the timeline lock at the start of the update
+		kShowMenus = 2,        // Menu visibility update during playback
+		kSample = 3,           // Playback clock, interpolation, constant speed and ground following
+		kGroundHeight = 4,     // Land/water height queries of ground following
+		kPropagatePlayer = 5,  // Moving the player (and its cell) along with the camera
+		kAudioListener = 6,    // Re-centering the audio listener on the camera
+		kRecord = 7,           // Recording camera points
+		kCommands = 8          // Applying API calls queued with QueueCommand
+	};
+
+	// Event counts of the frame profiler (see GetFrameCounter)
+	enum class FrameCounter : int {
+		kFrames = 0,                // Per-frame updates
+		kReferenceRequests = 1,     // Reference transforms requested by points during updates
+		kReferenceResolutions = 2,  // Reference transforms actually resolved (cache misses)
+		kSegmentSearches = 3        // Binary searches for the current segment (after a seek, loop or edit)
+	};
+
+	// Frame profiler statistics of one stage over the rolling window, times in microseconds
+	struct FrameStageStats {
+		uint64_t count;
+		double mean;
+		double p50;
+		double p90;
+		double p99;
+		double p999;
+		double max;
+	};
+
+	// Mutating API calls that can be queued with QueueCommand. Each uses the TimelineCommand fields listed here.
+	enum class CommandType : int {
+		kAddTranslationPoint = 0,     // time, value (position), easeIn, easeOut, interpolationMode
+		kAddRotationPoint = 1,        // time, value (x=pitch, y=roll, z=yaw in radians), easeIn, easeOut, interpolationMode
+		kAddFOVPoint = 2,             // time, value.x (FOV in degrees), easeIn, easeOut, interpolationMode
+		kRemoveTranslationPoint = 3,  // index
+		kRemoveRotationPoint = 4,     // index
+		kRemoveFOVPoint = 5,          // index
+		kClearTimeline = 6,
+		kSetPlaybackMode = 7,         // playbackMode, value.x (loop time offset)
+		kAutoRetimeByDistance = 8,
+		kStartPlayback = 9,           // value.x (speed), easeIn/easeOut (global easing), time (start time), useDuration/duration, constantSpeed
+		kStopPlayback = 10,
+		kPausePlayback = 11,
+		kResumePlayback = 12
+	};
+
+	// Arguments of a queued API call, fields not used by its type are ignored
+	struct TimelineCommand {
+		CommandType type;
+		size_t timelineID;
+		float time;
+		RE::NiPoint3 value;
+		size_t index;
+		bool easeIn;
+		bool easeOut;
+		InterpolationMode interpolationMode;
+		PlaybackMode playbackMode;
+		float duration;      // Seconds, used instead of value.x when useDuration is set
+		bool useDuration;
+		bool constantSpeed;  // Same as StartPlaybackAtConstantSpeed
+	};
+
+	// State of a queued API call (see GetCommandResult)
+	enum class CommandStatus : int {
+		kPending = 0,  // Not applied yet
+		kDone = 1,     // Applied, the result is available
+		kUnknown = 2   // Invalid ticket, or the result is too old (only the results of the last 4096 calls are kept)
+	};
+
+	// Keyframes of a TimelineBuilder (see IVFCFW3::CreateTimelineBuilder)
+	struct TranslationKey {
+		float time;
+		RE::NiPoint3 position;
+		bool easeIn;
+		bool easeOut;
+		InterpolationMode interpolationMode;
+	};
+
+	struct RotationKey {
+		float time;
+		RE::NiPoint3 rotation;  // x=pitch, y=roll, z=yaw in radians
+		bool easeIn;
+		bool easeOut;
+		InterpolationMode interpolationMode;
+	};
+
+	struct FOVKey {
+		float time;
+		float fov;              // Degrees (1-160)
+		bool easeIn;
+		bool easeOut;
+		InterpolationMode interpolationMode;
+	};
+
 	// Available FCFW interface versions
 	enum class InterfaceVersion : uint8_t {
-		V1
+		V1,
+		V2,  // V1 + batch sampling, baking, constant-speed playback, frame stage stats, trace capture, command queue
+		V3   // V2 + timeline builder
 	};
 
 	// FCFW's modder interface
@@ -529,6 +630,218 @@ namespace FCFW_API {
 		[[nodiscard]] virtual bool ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const noexcept = 0;
 	};
 
+	// FCFW's modder interface, version 2 (extends version 1)
+	class IVFCFW2 : public IVFCFW1 {
+	public:
+		/// <summary>
+		/// Sample the interpolated camera path at many times in one call (e.g. for path previews or exporters).
+		/// Equivalent to evaluating the timeline at each time individually, but the segment search is shared
+		/// between samples. Times do not need to be sorted. kCamera points use the values captured at the last playback start.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_timelineID">Timeline ID to sample</param>
+		/// <param name="a_times">Array of a_count timeline times in seconds</param>
+		/// <param name="a_count">Number of samples</param>
+		/// <param name="a_translations">Output array of a_count positions, or nullptr to skip translation</param>
+		/// <param name="a_rotations">Output array of a_count rotations (x=pitch, y=roll, z=yaw in radians), or nullptr to skip rotation</param>
+		/// <param name="a_fovs">Output array of a_count FOV values in degrees, or nullptr to skip FOV</param>
+		/// <returns>True if successful, false if timeline not found or not owned</returns>
+		[[nodiscard]] virtual bool SampleTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const float* a_times, size_t a_count, RE::NiPoint3* a_translations, RE::NiPoint3* a_rotations, float* a_fovs) const noexcept = 0;
+
+		/// <summary>
+		/// Compile the timeline into a dense sample buffer on a worker thread. Once finished, playback reads the
+		/// baked samples instead of interpolating the keyframes, for a fixed per-frame cost on long timelines.
+		/// Any edit of the timeline (adding/removing points, import, playback mode) discards the bake.
+		/// Only timelines without kReference and kCamera points can be baked.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_timelineID">Timeline ID to bake</param>
+		/// <param name="a_sampleRate">Samples per second (uniform), or the maximum density if a_tolerance > 0</param>
+		/// <param name="a_tolerance">If > 0, sample adaptively so that the maximum deviation from the exact path stays below this value (game units for position, degrees for rotation and FOV)</param>
+		/// <returns>True if baking was started, false if timeline not found, not owned or not bakeable</returns>
+		[[nodiscard]] virtual bool BakeTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_sampleRate, float a_tolerance = 0.0f) const noexcept = 0;
+
+		/// <summary>
+		/// Check if a bake of the timeline's current state is available.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_timelineID">Timeline ID to query</param>
+		/// <returns>True if playback uses baked samples, false otherwise</returns>
+		[[nodiscard]] virtual bool IsTimelineBaked(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept = 0;
+
+		/// <summary>
+		/// Start playback like StartPlayback(), but move the camera along the translation path at constant speed:
+		/// playback time maps linearly onto the distance travelled, independent of key spacing and segment easing.
+		/// Global easing still applies. Rotation and FOV keep following their key times.
+		/// Not available for timelines with kReference translation points.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_timelineID">Timeline ID to start playback on</param>
+		/// <param name="a_speed">Playback speed multiplier, only used if a_useDuration is false (default: 1.0)</param>
+		/// <param name="a_globalEaseIn">Apply ease-in at the start of entire playback (default: false)</param>
+		/// <param name="a_globalEaseOut">Apply ease-out at the end of entire playback (default: false)</param>
+		/// <param name="a_useDuration">If true, plays complete timeline with total time a_duration seconds; if false, uses a_speed multiplier (default: false)</param>
+		/// <param name="a_duration">Total duration in seconds for entire timeline, only used if a_useDuration is true (default: 0.0)</param>
+		/// <param name="a_startTime">Start playback at this time in seconds (default: 0.0 = start from beginning)</param>
+		/// <returns>true on success, false on failure</returns>
+		[[nodiscard]] virtual bool StartPlaybackAtConstantSpeed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed = 1.0f, bool a_globalEaseIn = false, bool a_globalEaseOut = false, bool a_useDuration = false, float a_duration = 0.0f, float a_startTime = 0.0f) const noexcept = 0;
+
+		/// <summary>
+		/// Get the length of the translation path in game units (sum of all segments, including the loop segment in kLoop mode).
+		/// Divide by a desired speed to get the duration for StartPlaybackAtConstantSpeed().
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_timelineID">Timeline ID to query</param>
+		/// <returns>Path length, or 0.0 if timeline not found or not owned</returns>
+		[[nodiscard]] virtual float GetTranslationPathLength(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept = 0;
+
+		/// <summary>
+		/// Re-distribute the translation key times so the camera moves at constant speed with regular playback.
+		/// First and last key times are kept, segments without movement keep their duration.
+		/// Rotation and FOV key times are warped along with the translation keys.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_timelineID">Timeline ID to modify</param>
+		/// <returns>true on success, false if timeline not found, not owned, has kReference translation points or no movement</returns>
+		[[nodiscard]] virtual bool AutoRetimeByDistance(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept = 0;
+
+		/// <summary>
+		/// Get frame time statistics of one update stage over the profiler's rolling window (about the last
+		/// WindowSeconds, see [Profiler] in FreeCameraFramework.ini). Only collected while the profiler is enabled there.
+		/// </summary>
+		/// <param name="a_stage">Stage to query</param>
+		/// <param name="a_stats">Receives count, mean and percentiles in microseconds</param>
+		/// <returns>true on success, false if the profiler is disabled or the arguments are invalid</returns>
+		[[nodiscard]] virtual bool GetFrameStageStats(FrameStage a_stage, FrameStageStats* a_stats) const noexcept = 0;
+
+		/// <summary>
+		/// Get an event count of the frame profiler over its rolling window.
+		/// </summary>
+		/// <param name="a_counter">Counter to query</param>
+		/// <returns>Count within the window, or 0 if the profiler is disabled</returns>
+		[[nodiscard]] virtual uint64_t GetFrameCounter(FrameCounter a_counter) const noexcept = 0;
+
+		/// <summary>
+		/// Start recording a Chrome trace-event file (open in chrome://tracing or ui.perfetto.dev) with spans for the
+		/// per-frame update stages, input handlers and YAML import/export, and instant events for playback start/stop/wait/switch.
+		/// Events are buffered in memory and written at every StopPlayback, on FlushTrace() and on StopTrace().
+		/// Later flushes write <name>_2.json, <name>_3.json, ...
+		/// </summary>
+		/// <param name="a_filePath">Output file path relative to the Data folder (e.g. "SKSE/Plugins/MyTrace.json")</param>
+		/// <returns>true on success, false if a trace is already being recorded or the path is empty</returns>
+		[[nodiscard]] virtual bool StartTrace(const char* a_filePath) const noexcept = 0;
+
+		/// <summary>
+		/// Write the trace events recorded since the last flush (asynchronously).
+		/// </summary>
+		/// <returns>true if a file is being written, false if no trace is recording or nothing was recorded</returns>
+		[[nodiscard]] virtual bool FlushTrace() const noexcept = 0;
+
+		/// <summary>
+		/// Flush the remaining trace events and stop recording.
+		/// </summary>
+		virtual void StopTrace() const noexcept = 0;
+
+		/// <summary>
+		/// Queue a mutating call instead of making it directly, e.g. from a background thread building a timeline.
+		/// Direct calls from other threads than FCFW's (see GetFCFWThreadId) contend with the per-frame update for
+		/// FCFW's locks; queued calls are applied by FCFW's thread at the start of the next frame, in submission order.
+		/// The queue holds 1024 calls; returns 0 if it is full.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation</param>
+		/// <param name="a_command">Call type and arguments</param>
+		/// <returns>Ticket (>0) for GetCommandResult() and WaitForCommand(), or 0 on failure</returns>
+		[[nodiscard]] virtual uint64_t QueueCommand(SKSE::PluginHandle a_pluginHandle, const TimelineCommand& a_command) const noexcept = 0;
+
+		/// <summary>
+		/// Get the result of a queued call without waiting: the point index (or -1) for kAdd... commands, 1 (success) or 0 for the others.
+		/// </summary>
+		/// <param name="a_ticket">Ticket returned by QueueCommand()</param>
+		/// <param name="a_result">Receives the result if the call was applied, may be nullptr</param>
+		/// <returns>kDone if a_result was written, kPending or kUnknown otherwise</returns>
+		[[nodiscard]] virtual CommandStatus GetCommandResult(uint64_t a_ticket, int* a_result) const noexcept = 0;
+
+		/// <summary>
+		/// Wait until a queued call has been applied, for synchronous use of the queue. Does not wait on FCFW's thread,
+		/// which applies the calls.
+		/// </summary>
+		/// <param name="a_ticket">Ticket returned by QueueCommand()</param>
+		/// <param name="a_result">Receives the result if the call was applied, may be nullptr</param>
+		/// <param name="a_timeoutMs">Maximum wait in milliseconds</param>
+		/// <returns>kDone if a_result was written, kPending after a timeout, kUnknown for an invalid ticket</returns>
+		[[nodiscard]] virtual CommandStatus WaitForCommand(uint64_t a_ticket, int* a_result, uint32_t a_timeoutMs) const noexcept = 0;
+	};
+
+	// Collects the keyframes of a whole timeline on the caller's thread and replaces a timeline's points with them in
+	// one step (see IVFCFW3::CreateTimelineBuilder). Adding keys never touches the timeline; Commit() sorts the keys
+	// outside FCFW's locks and only holds the timeline's lock to swap the finished tracks in.
+	// A builder may be used from any thread, but by one thread at a time.
+	class ITimelineBuilder {
+	public:
+		/// <summary>
+		/// Add translation keys, in any time order. Keys with equal times end up in the same order as if they were
+		/// added with AddTranslationPoint() one by one.
+		/// </summary>
+		/// <param name="a_keys">Array of a_count keys</param>
+		/// <param name="a_count">Number of keys</param>
+		/// <returns>true on success, false if a_keys is nullptr and a_count is not 0, or a key time is NaN or infinite (nothing is added)</returns>
+		virtual bool AddTranslationKeys(const TranslationKey* a_keys, size_t a_count) noexcept = 0;
+
+		/// <summary>
+		/// Add rotation keys, in any time order.
+		/// </summary>
+		/// <param name="a_keys">Array of a_count keys</param>
+		/// <param name="a_count">Number of keys</param>
+		/// <returns>true on success, false if a_keys is nullptr and a_count is not 0, or a key time is NaN or infinite (nothing is added)</returns>
+		virtual bool AddRotationKeys(const RotationKey* a_keys, size_t a_count) noexcept = 0;
+
+		/// <summary>
+		/// Add FOV keys, in any time order.
+		/// </summary>
+		/// <param name="a_keys">Array of a_count keys</param>
+		/// <param name="a_count">Number of keys</param>
+		/// <returns>true on success, false if a_keys is nullptr and a_count is not 0, or a key time is NaN or infinite (nothing is added)</returns>
+		virtual bool AddFOVKeys(const FOVKey* a_keys, size_t a_count) noexcept = 0;
+
+		/// <summary>
+		/// Remove all keys added so far.
+		/// </summary>
+		virtual void Clear() noexcept = 0;
+
+		/// <summary>
+		/// Replace all translation, rotation and FOV points of the timeline with the builder's keys. The playback mode
+		/// and loop offset of the timeline are kept, a running playback continues on the new points.
+		/// The builder keeps its keys, so it can be committed to several timelines.
+		/// </summary>
+		/// <param name="a_timelineID">Timeline ID, owned by the plugin handle the builder was created for</param>
+		/// <returns>true on success, false if the timeline was not found, is not owned or is recording</returns>
+		[[nodiscard]] virtual bool Commit(size_t a_timelineID) noexcept = 0;
+
+		/// <summary>
+		/// Destroy the builder. It must not be used afterwards.
+		/// </summary>
+		virtual void Release() noexcept = 0;
+
+		bool AddTranslationKeys(std::span<const TranslationKey> a_keys) noexcept { return AddTranslationKeys(a_keys.data(), a_keys.size()); }
+		bool AddRotationKeys(std::span<const RotationKey> a_keys) noexcept { return AddRotationKeys(a_keys.data(), a_keys.size()); }
+		bool AddFOVKeys(std::span<const FOVKey> a_keys) noexcept { return AddFOVKeys(a_keys.data(), a_keys.size()); }
+
+	protected:
+		~ITimelineBuilder() = default;  // Use Release()
+	};
+
+	// FCFW's modder interface, version 3 (extends version 2)
+	class IVFCFW3 : public IVFCFW2 {
+	public:
+		/// <summary>
+		/// Create a builder for filling a timeline with many keyframes at once, e.g. a procedural path built on a
+		/// background thread. Much faster than one AddTranslationPoint() call per point for large timelines.
+		/// </summary>
+		/// <param name="a_pluginHandle">Plugin handle for ownership validation at Commit()</param>
+		/// <returns>New builder (free it with Release()), or nullptr on failure</returns>
+		[[nodiscard]] virtual ITimelineBuilder* CreateTimelineBuilder(SKSE::PluginHandle a_pluginHandle) const noexcept = 0;
+	};
+
 	typedef void* (*_RequestPluginAPI)(const InterfaceVersion interfaceVersion);
 
 	/// <summary>
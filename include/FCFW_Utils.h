@@ -9,9 +9,92 @@ namespace FCFW {
     
     void ComputeHermiteBasis(float t, float& h00, float& h10, float& h01, float& h11);
 
+    // Cubic polynomial a*t^3 + b*t^2 + c*t + d, evaluated in Horner form
+    struct CubicCoefficients {
+        float a = 0.0f;
+        float b = 0.0f;
+        float c = 0.0f;
+        float d = 0.0f;
+
+        float Evaluate(float t) const { return ((a * t + b) * t + c) * t + d; }
+        float EvaluateDerivative(float t) const { return (3.0f * a * t + 2.0f * b) * t + c; }
+    };
+
+    // Polynomial form of CubicHermiteInterpolate for a fixed set of control values
+    CubicCoefficients ComputeCubicHermiteCoefficients(float a0, float a1, float a2, float a3);
+
+    // Evaluates one polynomial at many parameters (SSE/AVX2 when available, scalar tail)
+    void EvaluateCubicBatch(const CubicCoefficients& a_coefficients, std::span<const float> a_t, std::span<float> a_out);
+
+    // Eight polynomials sharing one parameter, one per SIMD lane (structure of arrays)
+    struct CubicLanes {
+        static constexpr size_t kLaneCount = 8;
+
+        alignas(32) float a[kLaneCount] = {};
+        alignas(32) float b[kLaneCount] = {};
+        alignas(32) float c[kLaneCount] = {};
+        alignas(32) float d[kLaneCount] = {};
+
+        void SetLane(size_t a_lane, const CubicCoefficients& a_coefficients) {
+            a[a_lane] = a_coefficients.a;
+            b[a_lane] = a_coefficients.b;
+            c[a_lane] = a_coefficients.c;
+            d[a_lane] = a_coefficients.d;
+        }
+    };
+
+    // Evaluates all lanes at t (AVX2/SSE when available), same results as CubicCoefficients::Evaluate per lane
+    void EvaluateCubicLanes(const CubicLanes& a_lanes, float t, float* a_out);
+
     float CubicHermiteInterpolate(float a0, float a1, float a2, float a3, float t);
 
-    float CubicHermiteInterpolateAngular(float a0, float a1, float a2, float a3, float t);
+    // Speed of the curve traced by N polynomial channels at parameter t
+    template <size_t N>
+    float ComputeCurveSpeed(const std::array<CubicCoefficients, N>& a_channels, float t) {
+        float speedSquared = 0.0f;
+        for (const CubicCoefficients& channel : a_channels) {
+            const float derivative = channel.EvaluateDerivative(t);
+            speedSquared += derivative * derivative;
+        }
+        return std::sqrt(speedSquared);
+    }
+
+    // Length of the curve traced by N polynomial channels between t0 and t1 (5-point Gauss-Legendre quadrature)
+    template <size_t N>
+    float ComputeArcLength(const std::array<CubicCoefficients, N>& a_channels, float a_t0, float a_t1) {
+        static constexpr float kNodes[5] = { 0.0f, -0.5384693101f, 0.5384693101f, -0.9061798459f, 0.9061798459f };
+        static constexpr float kWeights[5] = { 0.5688888889f, 0.4786286705f, 0.4786286705f, 0.2369268851f, 0.2369268851f };
+        const float halfSpan = 0.5f * (a_t1 - a_t0);
+        const float center = 0.5f * (a_t1 + a_t0);
+        float length = 0.0f;
+        for (size_t i = 0; i < 5; ++i) {
+            length += kWeights[i] * ComputeCurveSpeed(a_channels, center + halfSpan * kNodes[i]);
+        }
+        return length * halfSpan;
+    }
+
+    // Rotation quaternion w + xi + yj + zk
+    struct Quaternion {
+        float w = 1.0f;
+        float x = 0.0f;
+        float y = 0.0f;
+        float z = 0.0f;
+
+        float Dot(const Quaternion& a_other) const { return w * a_other.w + x * a_other.x + y * a_other.y + z * a_other.z; }
+        Quaternion operator-() const { return Quaternion{ -w, -x, -y, -z }; }
+    };
+
+    // Camera angles (pitch=x, roll=y, yaw=z) <-> quaternion: yaw about Z, then pitch about the right axis (X),
+    // then roll about the view axis (Y). Round trip is exact for |pitch| < 90 degrees.
+    Quaternion EulerToQuaternion(const RE::NiPoint3& a_euler);
+    RE::NiPoint3 QuaternionToEuler(const Quaternion& a_quat);
+
+    // Shortest-arc slerp as per-component polynomials (speed-corrected normalized lerp); normalize the result
+    std::array<CubicCoefficients, 4> ComputeQuaternionSlerpCoefficients(const Quaternion& q1, const Quaternion& q2);
+
+    // Catmull-Rom Hermite on hemisphere-aligned quaternion components (w, x, y, z); normalize the result
+    std::array<CubicCoefficients, 4> ComputeQuaternionHermiteCoefficients(const Quaternion& q0, const Quaternion& q1,
+                                                                          const Quaternion& q2, const Quaternion& q3);
 
     bool ParseFCFWTimelineFileSections(
         std::ifstream& a_file,
@@ -19,6 +102,11 @@ namespace FCFW {
         std::function<void(const std::map<std::string, std::string>&)> a_processSection
     );
 
+    // Load order lookups, cached (see PluginHandleCache.h). Papyrus natives pass their BSFixedString, which is
+    // resolved by its pooled pointer.
+#ifndef FCFW_HEADLESS
+    SKSE::PluginHandle ModNameToHandle(const RE::BSFixedString& a_modName);
+#endif
     SKSE::PluginHandle ModNameToHandle(const char* a_modName);
     bool IsPluginHandleValid(SKSE::PluginHandle a_handle);
 
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "PlaybackFrame.h"
+#include "ReferenceCache.h"
+#include <fstream>
+
+namespace FCFW {
+    // Frame capture: the game inputs of every playback frame of one timeline playback, written to a binary file so the
+    // playback can be replayed offline (headless/src/fcfw_replay.cpp) with the same inputs and compared to its outputs.
+    // Captured per frame: the real time delta, every reference resolution (ReferenceCache misses) and land height query,
+    // and the camera transform the frame produced. Per session: the playback settings and the camera at playback start.
+    struct CapturedForm {
+        RE::FormID m_formID = 0;
+        bool m_isActor = false;
+        std::string m_editorID;
+        std::string m_plugin;
+    };
+
+    struct CapturedReference {
+        RE::FormID m_formID = 0;
+        BodyPart m_bodyPart = BodyPart::kNone;
+        bool m_isOffsetRelative = false;
+        ResolvedReference m_resolved;
+    };
+
+    struct CapturedLandHeight {
+        RE::NiPoint3 m_position;
+        float m_height = 0.0f;
+    };
+
+    struct CapturedFrame {
+        float m_realDeltaTime = 0.0f;
+        std::vector<CapturedReference> m_references;
+        std::vector<CapturedLandHeight> m_landHeights;  // In query order
+        PlaybackFrame m_output;
+    };
+
+    struct CapturedSession {
+        PlaybackFrameSettings m_settings;
+        bool m_globalEaseIn = false;
+        bool m_globalEaseOut = false;
+        float m_startTime = 0.0f;
+        RE::NiPoint3 m_cameraPosition;  // Camera at playback start (kCamera points)
+        RE::NiPoint3 m_cameraRotation;  // pitch=x, roll=y, yaw=z
+        float m_cameraFOV = 80.0f;
+        std::vector<CapturedForm> m_forms;  // Every reference resolved during the session
+        std::vector<CapturedFrame> m_frames;
+    };
+
+    // Writer, driven by the playback thread: Arm() opens the file, the next playback writes its session into it and
+    // closes it when it stops.
+    class FrameCapture {
+    public:
+        static FrameCapture& GetSingleton() {
+            static FrameCapture instance;
+            return instance;
+        }
+        FrameCapture(const FrameCapture&) = delete;
+        FrameCapture& operator=(const FrameCapture&) = delete;
+
+        bool Arm(const std::filesystem::path& a_filePath);
+        void Disarm();  // Ends a running session
+        bool IsArmed() const { return m_file.is_open(); }
+        bool IsInSession() const { return m_inSession; }
+        const std::filesystem::path& GetFilePath() const { return m_filePath; }
+
+        // Timeline the capture was played from, exported next to it
+        static std::filesystem::path GetTimelineFilePath(const std::filesystem::path& a_capturePath) {
+            return std::filesystem::path(a_capturePath).concat(".yaml");
+        }
+
+        // a_session: settings and camera only, forms and frames are written as they occur
+        void BeginSession(const CapturedSession& a_session);
+        void EndSession();
+
+        void BeginFrame(float a_realDeltaTime);
+        void RecordReference(RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative, const ResolvedReference& a_resolved);
+        void RecordLandHeight(const RE::NiPoint3& a_position, float a_height);
+        void EndFrame(const PlaybackFrame& a_output);
+
+        static bool ReadFile(const std::filesystem::path& a_filePath, CapturedSession& a_session);
+
+    private:
+        FrameCapture() = default;
+
+        std::ofstream m_file;
+        std::filesystem::path m_filePath;
+        bool m_inSession = false;
+        bool m_inFrame = false;
+        std::uint32_t m_frameCount = 0;
+        std::vector<RE::FormID> m_writtenForms;
+    };
+
+    // Replay source: while a frame is set, reference resolutions and land heights come from that captured frame
+    // instead of the game (ReferenceCache and the replay's land height function ask here first).
+    class FrameReplay {
+    public:
+        static FrameReplay& GetSingleton() {
+            static FrameReplay instance;
+            return instance;
+        }
+        FrameReplay(const FrameReplay&) = delete;
+        FrameReplay& operator=(const FrameReplay&) = delete;
+
+        void SetFrame(const CapturedFrame* a_frame);  // nullptr ends the replay
+        bool IsActive() const { return m_frame != nullptr; }
+
+        // Captured resolution of (reference, body part, offset mode) in the current frame; not loaded if it has none
+        ResolvedReference ResolveReference(const RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative) const;
+        // Land heights are answered in query order; past the captured queries the last one repeats
+        float GetLandHeight(const RE::NiPoint3& a_position);
+
+    private:
+        FrameReplay() = default;
+
+        const CapturedFrame* m_frame = nullptr;
+        size_t m_nextLandHeight = 0;
+    };
+} // namespace FCFW
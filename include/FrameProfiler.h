@@ -0,0 +1,159 @@
+#pragma once
+
+#include "TraceRecorder.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace FCFW {
+    // Timed stages of TimelineManager::Update (same order as FCFW_API::FrameStage)
+    enum class FrameStage : std::uint8_t {
+        kUpdate,           // Whole Update() call, lock wait included
+        kLockWait,         // Waiting for the timeline lock at the start of Update()
+        kShowMenus,        // UI::ShowMenus during playback
+        kSample,           // AdvancePlayback: clock, interpolation, constant speed, ground following
+        kGroundHeight,     // GetLandHeightWithWater calls made by ground following
+        kPropagatePlayer,  // PropagatePlayerIfNeeded (player move and cell update)
+        kAudioListener,    // CorrectAudioListener
+        kRecord,           // RecordTimeline
+        kCommands,         // Applying queued API calls (TimelineCommandQueue)
+        kCount
+    };
+
+    // Event counts per frame window (same order as FCFW_API::FrameCounter)
+    enum class FrameCounter : std::uint8_t {
+        kFrames,                // Update() calls
+        kReferenceRequests,     // Reference transforms requested inside a frame scope
+        kReferenceResolutions,  // Reference transforms actually resolved (ReferenceCache misses)
+        kSegmentSearches,       // Binary searches after a segment cursor miss (seek, loop, first frame)
+        kCount
+    };
+
+    // Statistics of one stage over the rolling window, times in microseconds
+    struct FrameStageSummary {
+        std::uint64_t m_count = 0;
+        double m_mean = 0.0;
+        double m_p50 = 0.0;
+        double m_p90 = 0.0;
+        double m_p99 = 0.0;
+        double m_p999 = 0.0;
+        double m_max = 0.0;
+    };
+
+    // Low-overhead timing of the per-frame stages, enabled from FreeCameraFramework.ini ([Profiler] Enable=1).
+    // Durations go into log-linear histograms (16 sub-buckets per power of two, about 6% resolution from 16 ns to a minute,
+    // HDR histogram style) kept in a ring of kSlotCount time slots, so summaries cover the last window to window + 1 slot.
+    // Written from the main thread; counters may also be bumped from other threads, and summaries can be read from any
+    // thread (relaxed atomics: a summary taken during a frame may miss that frame's samples).
+    class FrameProfiler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static FrameProfiler& GetSingleton() {
+            static FrameProfiler instance;
+            return instance;
+        }
+        FrameProfiler(const FrameProfiler&) = delete;
+        FrameProfiler& operator=(const FrameProfiler&) = delete;
+
+        static bool IsEnabled() {
+            return s_enabled.load(std::memory_order_relaxed);
+        }
+
+        // a_windowSeconds: length of the rolling window; a_logIntervalSeconds: log a summary this often (0 = never);
+        // a_logOnStop: log a summary whenever playback or recording stops
+        void Configure(bool a_enabled, float a_windowSeconds, float a_logIntervalSeconds, bool a_logOnStop);
+
+        // Start of an Update() call: rotates the window slots and writes the periodic log summary
+        void BeginFrame();
+
+        void Record(FrameStage a_stage, Clock::duration a_duration);
+
+        static void Count(FrameCounter a_counter, std::uint64_t a_amount = 1) {
+            if (IsEnabled()) {
+                GetSingleton().AddCount(a_counter, a_amount);
+            }
+        }
+
+        FrameStageSummary GetSummary(FrameStage a_stage) const;
+        std::uint64_t GetCounter(FrameCounter a_counter) const;
+
+        // Writes all stage summaries and counters to the log (info level)
+        void LogSummary() const;
+
+        // Playback or recording stopped: logs a summary if configured
+        void OnTimelineStop() const;
+
+        static const char* GetStageName(FrameStage a_stage);
+        static const char* GetCounterName(FrameCounter a_counter);
+
+        // Times the enclosing scope into a stage, and into a trace span while the TraceRecorder is armed;
+        // no clock reads while both are off
+        class ScopedTimer {
+        public:
+            explicit ScopedTimer(FrameStage a_stage) : m_stage(a_stage), m_profile(IsEnabled()), m_trace(TraceRecorder::IsArmed()) {
+                if (m_profile || m_trace) {
+                    m_start = Clock::now();
+                }
+            }
+            ~ScopedTimer() {
+                if (m_profile || m_trace) {
+                    const auto end = Clock::now();
+                    if (m_profile) {
+                        GetSingleton().Record(m_stage, end - m_start);
+                    }
+                    if (m_trace) {
+                        TraceRecorder::Span(GetStageName(m_stage), m_start, end);
+                    }
+                }
+            }
+            ScopedTimer(const ScopedTimer&) = delete;
+            ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+        private:
+            FrameStage m_stage;
+            bool m_profile;
+            bool m_trace;
+            Clock::time_point m_start;
+        };
+
+    private:
+        FrameProfiler() = default;
+
+        static constexpr std::size_t kSubBucketBits = 4;
+        static constexpr std::size_t kSubBucketCount = 1 << kSubBucketBits;
+        static constexpr std::size_t kMaxExponent = 36;  // 2^36 ns, about 69 s; longer samples land in the last bucket
+        static constexpr std::size_t kBucketCount = kSubBucketCount + (kMaxExponent - kSubBucketBits + 1) * kSubBucketCount;
+        static constexpr std::size_t kSlotCount = 4;
+        static constexpr std::size_t kStageCount = static_cast<std::size_t>(FrameStage::kCount);
+        static constexpr std::size_t kCounterCount = static_cast<std::size_t>(FrameCounter::kCount);
+
+        struct Histogram {
+            std::array<std::atomic<std::uint32_t>, kBucketCount> m_buckets{};
+            std::atomic<std::uint64_t> m_totalNanoseconds{ 0 };
+            std::atomic<std::uint64_t> m_maxNanoseconds{ 0 };
+        };
+
+        struct Slot {
+            std::array<Histogram, kStageCount> m_stages;
+            std::array<std::atomic<std::uint64_t>, kCounterCount> m_counters{};
+        };
+
+        static std::size_t BucketIndex(std::uint64_t a_nanoseconds);
+        static double BucketValue(std::size_t a_index);  // Bucket midpoint in nanoseconds
+        static void ClearSlot(Slot& a_slot);
+
+        void AddCount(FrameCounter a_counter, std::uint64_t a_amount);
+
+        static inline std::atomic<bool> s_enabled{ false };
+
+        std::array<Slot, kSlotCount> m_slots;
+        std::atomic<std::size_t> m_currentSlot{ 0 };
+        Clock::duration m_slotDuration = std::chrono::milliseconds(2500);
+        Clock::time_point m_slotEnd{};
+        Clock::duration m_logInterval{};
+        Clock::time_point m_nextLog{};
+        bool m_logOnStop = false;
+    };
+} // namespace FCFW
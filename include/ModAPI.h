@@ -4,8 +4,10 @@
 namespace Messaging
 {
 	using InterfaceVersion1 = ::FCFW_API::IVFCFW1;
+	using InterfaceVersion2 = ::FCFW_API::IVFCFW2;
+	using InterfaceVersion3 = ::FCFW_API::IVFCFW3;
 
-	class FCFWInterface : public InterfaceVersion1
+	class FCFWInterface : public InterfaceVersion3
 	{
 	private:
 		FCFWInterface() noexcept;
@@ -64,6 +66,25 @@ namespace Messaging
 		virtual bool AddTimelineFromFile(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath, float a_timeOffset = 0.0f) const noexcept override;
 		virtual bool ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const noexcept override;
 
+		// InterfaceVersion2
+		virtual bool SampleTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const float* a_times, size_t a_count, RE::NiPoint3* a_translations, RE::NiPoint3* a_rotations, float* a_fovs) const noexcept override;
+		virtual bool BakeTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_sampleRate, float a_tolerance = 0.0f) const noexcept override;
+		virtual bool IsTimelineBaked(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+		virtual bool StartPlaybackAtConstantSpeed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed = 1.0f, bool a_globalEaseIn = false, bool a_globalEaseOut = false, bool a_useDuration = false, float a_duration = 0.0f, float a_startTime = 0.0f) const noexcept override;
+		virtual float GetTranslationPathLength(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+		virtual bool AutoRetimeByDistance(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+		virtual bool GetFrameStageStats(FCFW_API::FrameStage a_stage, FCFW_API::FrameStageStats* a_stats) const noexcept override;
+		virtual uint64_t GetFrameCounter(FCFW_API::FrameCounter a_counter) const noexcept override;
+		virtual bool StartTrace(const char* a_filePath) const noexcept override;
+		virtual bool FlushTrace() const noexcept override;
+		virtual void StopTrace() const noexcept override;
+		virtual uint64_t QueueCommand(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command) const noexcept override;
+		virtual FCFW_API::CommandStatus GetCommandResult(uint64_t a_ticket, int* a_result) const noexcept override;
+		virtual FCFW_API::CommandStatus WaitForCommand(uint64_t a_ticket, int* a_result, uint32_t a_timeoutMs) const noexcept override;
+
+		// InterfaceVersion3
+		virtual FCFW_API::ITimelineBuilder* CreateTimelineBuilder(SKSE::PluginHandle a_pluginHandle) const noexcept override;
+
 	private:
 		unsigned long apiTID = 0;
 	};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Timeline.h"
+#include <functional>
+
+namespace FCFW {
+    // Per-frame playback parameters of a running timeline (see TimelineState)
+    struct PlaybackFrameSettings {
+        float m_speed = 1.0f;                   // Timeline seconds per real second
+        bool m_constantSpeed = false;           // Translation sampled by distance along the path
+        bool m_followGround = false;            // Keep the camera m_minHeightAboveGround above the land height
+        float m_minHeightAboveGround = 0.0f;
+    };
+
+    // Camera transform produced by one playback frame, before user rotation offsets
+    struct PlaybackFrame {
+        RE::NiPoint3 m_position;
+        RE::NiPoint3 m_rotation;  // pitch=x, roll=y, yaw=z
+        float m_fov = 0.0f;       // Only valid if m_hasFOV
+        bool m_hasFOV = false;    // Timeline has FOV points
+    };
+
+    using LandHeightFunction = std::function<float(const RE::NiPoint3&)>;
+
+    // Advances the playback clock by a_realDeltaTime * speed and samples the camera for the new time: from the bake if
+    // one is current, else in one pass if the tracks share keys, else per track; then constant speed and ground following.
+    // Game-independent, so TimelineManager::PlayTimeline and the headless replay run the same code.
+    PlaybackFrame AdvancePlayback(Timeline& a_timeline, const PlaybackFrameSettings& a_settings, float a_realDeltaTime,
+                                  const LandHeightFunction& a_getLandHeight);
+} // namespace FCFW
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+namespace FCFW {
+    // Active timeline as seen by the input hooks and the idle path of TimelineManager::Update
+    struct PlaybackSnapshot {
+        std::size_t m_activeTimelineID = 0;  // 0: no timeline playing or recording
+        bool m_isPlaybackRunning = false;
+        bool m_isRecording = false;
+        bool m_allowUserRotation = false;
+    };
+
+    // PlaybackSnapshot packed into one atomic word: timeline ID in the low 61 bits, flags in the top 3.
+    // TimelineManager publishes it under its lock after every change of the active timeline; readers load it without
+    // the lock or a map lookup, and always see a consistent snapshot from before or after a change.
+    class PlaybackStateWord {
+    public:
+        void Publish(const PlaybackSnapshot& a_snapshot) {
+            m_word.store(Pack(a_snapshot), std::memory_order_release);
+        }
+
+        PlaybackSnapshot Load() const {
+            return Unpack(m_word.load(std::memory_order_acquire));
+        }
+
+        static constexpr std::uint64_t Pack(const PlaybackSnapshot& a_snapshot) {
+            return (static_cast<std::uint64_t>(a_snapshot.m_activeTimelineID) & kIDMask) |
+                   (a_snapshot.m_isPlaybackRunning ? kRunningBit : 0) |
+                   (a_snapshot.m_isRecording ? kRecordingBit : 0) |
+                   (a_snapshot.m_allowUserRotation ? kAllowUserRotationBit : 0);
+        }
+
+        static constexpr PlaybackSnapshot Unpack(std::uint64_t a_word) {
+            return PlaybackSnapshot{ static_cast<std::size_t>(a_word & kIDMask), (a_word & kRunningBit) != 0,
+                                     (a_word & kRecordingBit) != 0, (a_word & kAllowUserRotationBit) != 0 };
+        }
+
+    private:
+        static constexpr std::uint64_t kRunningBit = std::uint64_t{ 1 } << 61;
+        static constexpr std::uint64_t kRecordingBit = std::uint64_t{ 1 } << 62;
+        static constexpr std::uint64_t kAllowUserRotationBit = std::uint64_t{ 1 } << 63;
+        static constexpr std::uint64_t kIDMask = kRunningBit - 1;
+
+        std::atomic<std::uint64_t> m_word{ 0 };
+    };
+} // namespace FCFW
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace FCFW {
+    // Mod name -> plugin handle (compile index) lookup for the Papyrus natives, which pass the mod name with every call.
+    // Rebuild() reads the load order once. Find() then resolves an interned name (BSFixedString data is pooled, one
+    // pointer per distinct name) with a single pointer-keyed lookup, filled on the first use of each pointer.
+    // A hit still compares the name, in case the pool freed the string and reused its pointer for another one.
+    // IsValid() checks a bitset of the handles in the load order. Natives run on several VM threads, so lookups
+    // take a shared lock.
+    class PluginHandleCache {
+    public:
+        struct LoadOrderFile {
+            std::string_view m_fileName;
+            std::uint32_t m_compileIndex;
+        };
+
+        // a_signature identifies the load order it was built from (e.g. the loaded file counts)
+        bool IsCurrent(std::uint64_t a_signature) const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return m_isBuilt && m_signature == a_signature;
+        }
+
+        void Rebuild(std::span<const LoadOrderFile> a_files, std::uint64_t a_signature) {
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            m_handlesByName.clear();
+            m_handlesByPointer.clear();
+            m_validHandles.reset();
+            for (const LoadOrderFile& file : a_files) {
+                m_handlesByName.try_emplace(std::string(file.m_fileName), file.m_compileIndex);  // First file wins, like the scan did
+                if (file.m_compileIndex < m_validHandles.size()) {
+                    m_validHandles.set(file.m_compileIndex);
+                }
+            }
+            m_signature = a_signature;
+            m_isBuilt = true;
+        }
+
+        // a_internedName must stay valid and be the only pointer for its name, like pooled BSFixedString data.
+        // Returns 0 if the name is not in the load order (also cached).
+        SKSE::PluginHandle Find(const char* a_internedName) {
+            {
+                std::shared_lock<std::shared_mutex> lock(m_mutex);
+                if (auto it = m_handlesByPointer.find(a_internedName); it != m_handlesByPointer.end() && it->second.m_name == a_internedName) {
+                    return it->second.m_handle;
+                }
+            }
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            const SKSE::PluginHandle handle = FindByNameLocked(a_internedName);
+            m_handlesByPointer.insert_or_assign(a_internedName, InternedName{ a_internedName, handle });
+            return handle;
+        }
+
+        // Any name string, without the pointer cache
+        SKSE::PluginHandle FindByName(std::string_view a_name) const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return FindByNameLocked(a_name);
+        }
+
+        bool IsValid(SKSE::PluginHandle a_handle) const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return a_handle != 0 && a_handle < m_validHandles.size() && m_validHandles.test(a_handle);
+        }
+
+    private:
+        struct NameHash {
+            using is_transparent = void;
+            std::size_t operator()(std::string_view a_name) const { return std::hash<std::string_view>{}(a_name); }
+        };
+
+        struct InternedName {
+            std::string m_name;
+            SKSE::PluginHandle m_handle{ 0 };
+        };
+
+        SKSE::PluginHandle FindByNameLocked(std::string_view a_name) const {
+            auto it = m_handlesByName.find(a_name);
+            return it != m_handlesByName.end() ? it->second : 0;
+        }
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<std::string, SKSE::PluginHandle, NameHash, std::equal_to<>> m_handlesByName;
+        std::unordered_map<const char*, InternedName> m_handlesByPointer;
+        std::bitset<256> m_validHandles;  // Compile indices are 8 bit
+        std::uint64_t m_signature{ 0 };
+        bool m_isBuilt{ false };
+    };
+} // namespace FCFW
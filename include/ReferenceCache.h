@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CameraTypes.h"
+#include <mutex>
+
+namespace FCFW {
+    // Transform of a reference (or one of an actor's body parts) as consumed by kReference points
+    struct ResolvedReference {
+        bool m_isLoaded = false;      // Reference 3D was loaded at resolution time; all other fields are unset otherwise
+        bool m_hasBodyFrame = false;  // Body part node found (relative mode only): m_forward/m_right/m_up are valid
+        RE::NiPoint3 m_position;      // Body part node position, or reference root position
+        RE::NiPoint3 m_forward;       // Body part frame in world space (relative mode only)
+        RE::NiPoint3 m_right;
+        RE::NiPoint3 m_up;
+        RE::NiPoint3 m_rotation;      // Relative mode only - pitch=x, roll=y, yaw=z: body part rotation, actor heading (yaw only) or reference angles
+    };
+
+    // Per-frame cache of reference transforms.
+    // While a FrameScope is open on the calling thread, each (reference, body part, offset mode) is resolved at most once
+    // and shared by every point and track referring to it. Without an open scope every request resolves directly, so
+    // Papyrus-thread calls and paused timelines never see stale transforms.
+    class ReferenceCache {
+    public:
+        struct Stats {
+            std::uint32_t m_requests = 0;     // Resolutions that would have happened without the cache
+            std::uint32_t m_resolutions = 0;  // Resolutions actually performed
+        };
+
+        class FrameScope {
+        public:
+            FrameScope();
+            ~FrameScope();
+            FrameScope(const FrameScope&) = delete;
+            FrameScope& operator=(const FrameScope&) = delete;
+        };
+
+        static ResolvedReference Resolve(RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative);
+
+        // Counters of the last closed frame scope on the calling thread
+        static Stats GetLastFrameStats();
+    };
+
+    // Body part nodes resolved per (actor, body part), so tracking a head or torso is a pointer dereference instead of
+    // a walk of the actor's body part data. An entry is dropped when the actor's 3D root changes (3D reset) or when the
+    // actor unloads (TESObjectLoadedEvent).
+    class BodyPartNodeCache : public RE::BSTEventSink<RE::TESObjectLoadedEvent> {
+    public:
+        static BodyPartNodeCache& GetSingleton() {
+            static BodyPartNodeCache instance;
+            return instance;
+        }
+        BodyPartNodeCache(const BodyPartNodeCache&) = delete;
+        BodyPartNodeCache& operator=(const BodyPartNodeCache&) = delete;
+
+        // Registers the load/unload event sink (after kDataLoaded)
+        void Register();
+
+        // Fills position, and with a_withOrientation the body part frame and rotation. False if the node is not found.
+        bool Resolve(RE::Actor* a_actor, BodyPart a_bodyPart, bool a_withOrientation, ResolvedReference& a_out);
+
+        RE::BSEventNotifyControl ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>* a_eventSource) override;
+
+    private:
+        BodyPartNodeCache() = default;
+
+        // How the body part frame is obtained from the cached node
+        enum class FrameSource {
+            kUnknown,  // Not captured yet (or the node rotation was ambiguous when sampled)
+            kColumns,  // Frame = node rotation * mapping
+            kRows,     // Frame = transposed node rotation * mapping
+            kLibrary   // No fixed mapping: ask _ts_SKSEFunctions every time
+        };
+
+        // Whether GetBodyPartRotation equals the Euler angles of the body part frame
+        enum class RotationSource {
+            kUnverified,
+            kFromFrame,
+            kLibrary
+        };
+
+        struct Entry {
+            RE::Actor* m_actor = nullptr;
+            RE::FormID m_formID = 0;
+            BodyPart m_bodyPart = BodyPart::kNone;
+            RE::NiAVObject* m_root = nullptr;           // Actor 3D root at resolution time; a different root means a 3D reset
+            RE::NiPointer<RE::NiAVObject> m_node;       // Body part node (null: not found for this 3D)
+            FrameSource m_frameSource = FrameSource::kUnknown;
+            float m_frameMapping[3][3] = {};            // Signed axis permutation: node rotation -> (right, forward, up) columns
+        };
+
+        Entry& FindOrAddEntry(RE::Actor* a_actor, BodyPart a_bodyPart);
+        void ResolveFrame(Entry& a_entry, RE::Actor* a_actor, ResolvedReference& a_out);
+        RE::NiPoint3 ResolveRotation(const Entry& a_entry, RE::Actor* a_actor, const ResolvedReference& a_resolvedFrame);
+
+        std::mutex m_lock;
+        std::vector<Entry> m_entries;  // A few tracked actors: linear search beats hashing
+        RotationSource m_rotationSource = RotationSource::kUnverified;  // Shared by all entries: one library convention
+    };
+} // namespace FCFW
@@ -1,9 +1,68 @@
 #pragma once
 
+#include "TimelineClock.h"
 #include "TimelineTrack.h"
+#include <memory>
+#include <optional>
 
 namespace FCFW
 {	
+	// Dense sample buffer compiled from a timeline without runtime-resolved points (see Timeline::Bake).
+	// Lookups are O(1): the time axis is split into cells no wider than the smallest sample spacing,
+	// so each cell start maps directly to the sample at or before it.
+	struct TimelineBake
+	{
+		std::uint64_t m_revision{ 0 };         // Timeline revision the samples were taken from
+		float m_duration{ 0.0f };
+		float m_cellWidth{ 0.0f };
+		std::vector<std::uint32_t> m_cellStart;  // Index of the last sample at or before each cell start
+		std::vector<float> m_times;             // Ascending sample times, first 0 and last m_duration
+		std::vector<RE::NiPoint3> m_translations;
+		std::vector<RE::NiPoint3> m_rotations;  // pitch=x, roll=y, yaw=z in radians
+		std::vector<float> m_fovs;
+
+		RE::NiPoint3 GetTranslation(float a_time) const;
+		RE::NiPoint3 GetRotation(float a_time) const;
+		float GetFOV(float a_time) const;
+		size_t GetSampleCount() const { return m_times.size(); }
+
+	private:
+		// Sample index i with m_times[i] <= a_time < m_times[i + 1], and the progress between both
+		size_t FindSample(float a_time, float& a_progress) const;
+	};
+
+	// Evaluator for timelines whose tracks share key times, interpolation modes and easing (recorded timelines).
+	// One segment search and one eased parameter drive all channels, evaluated as a single 8-lane polynomial:
+	// translation x/y/z, rotation quaternion w/x/y/z and FOV. Built at StartPlayback, dropped by any edit.
+	struct SharedKeyBlock
+	{
+		static constexpr std::uint8_t kTranslationLanes = 0x01;
+		static constexpr std::uint8_t kRotationLanes = 0x02;
+		static constexpr std::uint8_t kFOVLanes = 0x04;
+
+		struct Segment
+		{
+			CubicLanes m_lanes;                   // Lanes 0-2 translation, 3-6 rotation quaternion, 7 FOV
+			RE::NiPoint3 m_translation;           // Fixed values of tracks whose lanes are not polynomial here
+			RE::NiPoint3 m_rotation;
+			float m_fov{ 0.0f };
+			std::uint8_t m_polynomialMask{ 0 };   // k*Lanes of the tracks evaluated from m_lanes
+			bool m_easeIn{ false };
+			bool m_easeOut{ false };
+		};
+
+		std::vector<float> m_times;
+		std::vector<Segment> m_segments;          // Segment ending at point i; index m_times.size() is the virtual loop segment
+		float m_loopTimeOffset{ 0.0f };
+		bool m_hasLoopSegment{ false };
+		mutable size_t m_cursor{ 0 };             // Segment found by the last lookup (playback locality hint)
+
+		void Evaluate(float a_time, RE::NiPoint3& a_translation, RE::NiPoint3& a_rotation, float& a_fov) const;
+
+	private:
+		size_t FindSegment(float a_time) const;
+	};
+
 	class Timeline
 	{
 	public:
@@ -13,23 +72,62 @@ namespace FCFW
 	size_t AddTranslationPoint(const TranslationPoint& a_point);
 	size_t AddRotationPoint(const RotationPoint& a_point);
 	size_t AddFOVPoint(const FOVPoint& a_point);
+	// Batch edits: one sorted merge and one reset per call, same result as adding the points one by one.
+	// Return the new point count of the track.
+	size_t AddTranslationPoints(std::span<const TranslationPoint> a_points);
+	size_t AddRotationPoints(std::span<const RotationPoint> a_points);
+	size_t AddFOVPoints(std::span<const FOVPoint> a_points);
+	// Exchanges all points with tracks built elsewhere (timeline builder commits). Playback mode and loop offset of
+	// the timeline are kept; the previous points end up in the arguments, to be freed outside the timeline's lock.
+	void SwapPoints(TranslationTrack& a_translationTrack, RotationTrack& a_rotationTrack, FOVTrack& a_fovTrack);
+	// Copy of this timeline with the given points instead of its own, which are not copied: after a SwapPoints during
+	// playback, the next version is assembled from copies of the new tracks made before locking
+	std::shared_ptr<Timeline> CopyWithPoints(TranslationTrack a_translationTrack, RotationTrack a_rotationTrack, FOVTrack a_fovTrack) const;
 	void RemoveTranslationPoint(size_t a_index);
 	void RemoveRotationPoint(size_t a_index);
 	void RemoveFOVPoint(size_t a_index);		void UpdatePlayback(float a_deltaTime);
 		void StartPlayback();
+		// Edits during playback (see TimelineVersionSlot): an edited copy is prepared off the frame, without touching
+		// the clock or kCamera points, and then continues the playback of the version it replaces
+		void PrepareForPlayback();
+		void ContinuePlayback(const Timeline& a_previous);
 		void ResetPlayback();
 		void PausePlayback();
 		void ResumePlayback();
+		void SetGlobalEasing(bool a_easeIn, bool a_easeOut);
 
 	RE::NiPoint3 GetTranslation(float a_time) const;
 	RE::NiPoint3 GetRotation(float a_time) const;
 	float GetFOV(float a_time) const;
+	// Samples all three tracks at many times in one pass; empty output spans skip that track
+	bool SampleBatch(std::span<const float> a_times, std::span<RE::NiPoint3> a_translations, std::span<RE::NiPoint3> a_rotations, std::span<float> a_fovs) const;
+
+	// Shared-key playback (see SharedKeyBlock), detected at StartPlayback
+	bool HasSharedKeys() const { return m_sharedKeys.has_value(); }
+	void SampleSharedKeys(float a_time, RE::NiPoint3& a_translation, RE::NiPoint3& a_rotation, float& a_fov) const;
+
+	// Baking: a_sampleRate samples per second, or with a_tolerance > 0 adaptive sampling that keeps the
+	// linear reconstruction within a_tolerance (game units, degrees) and uses a_sampleRate as the maximum density.
+	// Any edit bumps the revision and drops the bake; SetBake() refuses bakes of an older revision.
+	bool IsBakeable() const;
+	std::shared_ptr<const TimelineBake> Bake(float a_sampleRate, float a_tolerance) const;
+	bool SetBake(std::shared_ptr<const TimelineBake> a_bake);
+	const TimelineBake* GetBake() const { return m_bake.get(); }
+	std::uint64_t GetRevision() const { return m_revision; }
+
+	// Arc length of the translation path: constant speed sampling and retiming keys by distance.
+	// AutoRetimeByDistance keeps the first and last key time and warps rotation/FOV keys along.
+	float GetTranslationPathLength() const;
+	RE::NiPoint3 GetTranslationAtConstantSpeed(float a_time) const;
+	bool SupportsConstantSpeed() const;
+	bool AutoRetimeByDistance();
 
 	size_t GetTranslationPointCount() const;
 	size_t GetRotationPointCount() const;
 	size_t GetFOVPointCount() const;
 		float GetDuration() const;
 		float GetPlaybackTime() const;
+		float GetSampleTime() const;  // Playback time with global easing applied
 		void SetPlaybackTime(float a_time);
 		bool IsPlaying() const;
 		bool IsPaused() const;
@@ -54,8 +152,21 @@ namespace FCFW
 
 	RE::NiPoint3 GetTranslationPoint(size_t a_index) const;
 	RE::NiPoint3 GetRotationPoint(size_t a_index) const;
-	float GetFOVPoint(size_t a_index) const;private:
+	float GetFOVPoint(size_t a_index) const;
+	// Times and values of all points of a track in one pass (see TimelineTrack::GetPoints)
+	void GetTranslationPoints(std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_positions) const;
+	void GetRotationPoints(std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_rotations) const;
+	void GetFOVPoints(std::vector<float>& a_times, std::vector<float>& a_fovs) const;private:
 	TranslationTrack m_translationTrack;  // Position keyframes
 	RotationTrack m_rotationTrack;        // Rotation keyframes
 	FOVTrack m_fovTrack;                  // FOV keyframes
+	TimelineClock m_clock;                // Playback time, mode, loop offset and global easing for all tracks
+
+	void Invalidate();
+	void ApplyClockToTracks();  // Playback mode and loop offset shape each track's loop segment
+	void BuildSharedKeys();
+
+	std::uint64_t m_revision{ 0 };                // Incremented by every edit
+	std::shared_ptr<const TimelineBake> m_bake;   // Valid for m_revision only
+	std::optional<SharedKeyBlock> m_sharedKeys;   // Present while the tracks share keys (built at StartPlayback)
 };}  // namespace FCFW
\ No newline at end of file
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CameraPath.h"
+
+namespace FCFW {
+    // Implementation of FCFW_API::ITimelineBuilder (interface V3). Keys are converted to points as they are added;
+    // Commit() sorts them into complete tracks on the calling thread and hands those to
+    // TimelineManager::SwapTimelinePoints, so the timeline's lock is only held for the swap.
+    class TimelineBuilder final : public FCFW_API::ITimelineBuilder {
+    public:
+        explicit TimelineBuilder(SKSE::PluginHandle a_pluginHandle) noexcept : m_pluginHandle(a_pluginHandle) {}
+
+        using ITimelineBuilder::AddTranslationKeys;
+        using ITimelineBuilder::AddRotationKeys;
+        using ITimelineBuilder::AddFOVKeys;
+
+        bool AddTranslationKeys(const FCFW_API::TranslationKey* a_keys, size_t a_count) noexcept override;
+        bool AddRotationKeys(const FCFW_API::RotationKey* a_keys, size_t a_count) noexcept override;
+        bool AddFOVKeys(const FCFW_API::FOVKey* a_keys, size_t a_count) noexcept override;
+        void Clear() noexcept override;
+        bool Commit(size_t a_timelineID) noexcept override;
+        void Release() noexcept override;
+
+    private:
+        SKSE::PluginHandle m_pluginHandle;
+        std::vector<TranslationPoint> m_translationPoints;
+        std::vector<RotationPoint> m_rotationPoints;
+        std::vector<FOVPoint> m_fovPoints;
+    };
+}
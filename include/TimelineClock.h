@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CameraTypes.h"
+
+namespace FCFW
+{
+	// Playback clock shared by all tracks of a Timeline. It advances time and applies the end/loop/wait
+	// playback modes, the loop offset and global easing; the tracks only evaluate the time it hands out.
+	class TimelineClock
+	{
+	public:
+		void Update(float a_deltaTime);
+		void Start();
+		void Reset();
+		void Pause() { m_isPaused = true; }
+		void Resume() { m_isPaused = false; }
+		// Takes over a_previous's time, playing/paused state and global easing; keeps this clock's key range and mode
+		void ContinueFrom(const TimelineClock& a_previous);
+
+		float GetTime() const { return m_time; }
+		void SetTime(float a_time);
+		// Playback time with global easing applied (the time the tracks are evaluated at)
+		float GetSampleTime() const;
+		bool IsPlaying() const { return m_isPlaying; }
+		bool IsPaused() const { return m_isPaused; }
+
+		// Duration of the longest track, plus the loop offset in loop mode. The owner reports the key range after edits.
+		float GetDuration() const;
+		void SetKeyRange(bool a_hasPoints, float a_lastPointTime);
+
+		void SetPlaybackMode(PlaybackMode a_mode) { m_playbackMode = a_mode; }
+		PlaybackMode GetPlaybackMode() const { return m_playbackMode; }
+		void SetLoopTimeOffset(float a_offset) { m_loopTimeOffset = a_offset; }
+		float GetLoopTimeOffset() const { return m_loopTimeOffset; }
+		void SetGlobalEasing(bool a_easeIn, bool a_easeOut);
+
+	private:
+		float m_time{ 0.0f };                               // Current position in timeline (seconds)
+		bool m_isPlaying{ false };                          // Playback active
+		bool m_isPaused{ false };                           // Playback paused
+		bool m_hasPoints{ false };                          // Any track has points
+		float m_lastPointTime{ 0.0f };                      // Latest point time over all tracks
+		PlaybackMode m_playbackMode{ PlaybackMode::kEnd };  // kEnd (stop), kLoop (wrap) or kWait (hold at end)
+		float m_loopTimeOffset{ 0.0f };                     // Extra time for loop interpolation (last→first)
+		bool m_globalEaseIn{ false };                       // Ease the whole timeline in
+		bool m_globalEaseOut{ false };                      // Ease the whole timeline out
+	};
+}  // namespace FCFW
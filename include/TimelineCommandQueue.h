@@ -0,0 +1,93 @@
+#pragma once
+
+#include "BoundedMPSCQueue.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace FCFW {
+    // Mutating API calls queued by plugin threads (FCFW_API::IVFCFW2::QueueCommand). TimelineManager::Update drains
+    // them on the main thread at the start of each frame, in submission order, before it takes any timeline lock.
+    // A ticket is the submission position + 1; the results of the last kResultHistory tickets can be read back.
+    class TimelineCommandQueue {
+    public:
+        static constexpr std::size_t kCapacity = 1024;
+        static constexpr std::size_t kResultHistory = 4096;
+
+        // Any thread. Returns the ticket, or 0 if the queue is full.
+        std::uint64_t Submit(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command) {
+            const auto position = m_queue.Push(QueuedCommand{ a_pluginHandle, a_command });
+            return position ? *position + 1 : 0;
+        }
+
+        // Main thread only
+        bool HasPending() const { return m_queue.HasPending(); }
+
+        // Main thread only. a_apply(pluginHandle, command) returns the command's result. Commands submitted while
+        // draining wait for the next frame once a full queue's worth has been applied.
+        template <class ApplyFn>
+        void Drain(ApplyFn&& a_apply) {
+            QueuedCommand command;
+            std::uint64_t position = 0;
+            for (std::size_t count = 0; count < kCapacity && m_queue.Pop(command, position); ++count) {
+                const int result = a_apply(command.m_pluginHandle, command.m_command);
+                {
+                    std::lock_guard<std::mutex> lock(m_resultsMutex);
+                    m_results[position % kResultHistory] = Result{ position + 1, result };
+                    m_appliedTickets = position + 1;
+                }
+                m_resultsChanged.notify_all();
+            }
+        }
+
+        FCFW_API::CommandStatus GetResult(std::uint64_t a_ticket, int* a_result) const {
+            std::lock_guard<std::mutex> lock(m_resultsMutex);
+            return GetResultLocked(a_ticket, a_result);
+        }
+
+        FCFW_API::CommandStatus Wait(std::uint64_t a_ticket, int* a_result, std::chrono::milliseconds a_timeout) const {
+            std::unique_lock<std::mutex> lock(m_resultsMutex);
+            FCFW_API::CommandStatus status = GetResultLocked(a_ticket, a_result);
+            m_resultsChanged.wait_for(lock, a_timeout, [&] {
+                status = GetResultLocked(a_ticket, a_result);
+                return status != FCFW_API::CommandStatus::kPending;
+            });
+            return status;
+        }
+
+    private:
+        struct QueuedCommand {
+            SKSE::PluginHandle m_pluginHandle{ 0 };
+            FCFW_API::TimelineCommand m_command{};
+        };
+
+        struct Result {
+            std::uint64_t m_ticket{ 0 };
+            int m_result{ 0 };
+        };
+
+        FCFW_API::CommandStatus GetResultLocked(std::uint64_t a_ticket, int* a_result) const {
+            if (a_ticket == 0 || a_ticket > m_queue.GetPushCount()) {
+                return FCFW_API::CommandStatus::kUnknown;
+            }
+            if (a_ticket > m_appliedTickets) {
+                return FCFW_API::CommandStatus::kPending;
+            }
+            const Result& result = m_results[(a_ticket - 1) % kResultHistory];
+            if (result.m_ticket != a_ticket) {
+                return FCFW_API::CommandStatus::kUnknown;  // Overwritten by newer results
+            }
+            if (a_result) {
+                *a_result = result.m_result;
+            }
+            return FCFW_API::CommandStatus::kDone;
+        }
+
+        BoundedMPSCQueue<QueuedCommand, kCapacity> m_queue;
+
+        mutable std::mutex m_resultsMutex;  // Leaf lock, never held while applying a command
+        mutable std::condition_variable m_resultsChanged;
+        std::array<Result, kResultHistory> m_results{};
+        std::uint64_t m_appliedTickets{ 0 };  // Tickets up to this one have been applied
+    };
+} // namespace FCFW
@@ -1,8 +1,12 @@
 #pragma once
 
 #include "Timeline.h"
+#include "PlaybackStateWord.h"
+#include "TimelineVersionSlot.h"
+#include "TimelineCommandQueue.h"
 #include <atomic>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -13,6 +17,8 @@ namespace FCFW {
         size_t m_id{ 0 };                      // Timeline unique identifier
         SKSE::PluginHandle m_ownerHandle{ 0 }; // Plugin that owns this timeline
         std::string m_ownerName;               // Plugin name (for logging)
+        mutable std::shared_mutex m_lock;      // Guards all fields below: shared for queries, exclusive for edits and playback
+        mutable std::mutex m_editLock;         // Held as well to modify m_timeline; alone to evaluate or copy it (see EvaluateTimeline)
         
         // ===== TIMELINE DATA & STATIC CONFIGURATION (persisted in YAML) =====
         Timeline m_timeline;                   // Paired translation + rotation tracks
@@ -34,8 +40,11 @@ namespace FCFW {
         bool m_isCompletedAndWaiting{ false }; // kWait mode completion flag (runtime only)
         bool m_followGround{ true };           // Keep camera above ground level during playback (runtime only)
         float m_minHeightAboveGround{ 0.0f }; // Minimum height above ground when following ground (runtime only)
+        bool m_constantSpeed{ false };         // Sample translation by distance along the path (runtime only)
         RE::NiPoint3 m_rotationOffset{ 0.0f, 0.0f, 0.0f }; // Accumulated user rotation (runtime only) - pitch=x, roll=y, yaw=z
         float m_savedFOV{ 80.0f };             // FOV before playback starts
+        std::shared_ptr<Timeline> m_playingTimeline;  // Version being played, a copy of m_timeline (runtime only)
+        TimelineVersionSlot m_publishedTimeline;      // Edits made during playback, picked up by the next frame (runtime only)
         
         void Initialize(size_t a_id, SKSE::PluginHandle a_ownerHandle) {
             m_id = a_id;
@@ -64,8 +73,44 @@ namespace FCFW {
             m_isCompletedAndWaiting = false;
             m_followGround = true;
             m_minHeightAboveGround = 0.0f;
+            m_constantSpeed = false;
             m_rotationOffset = { 0.0f, 0.0f, 0.0f };
             m_savedFOV = 80.0f;
+            m_playingTimeline.reset();
+            m_publishedTimeline.Clear();
+        }
+        
+        // Playback runs on a copy of m_timeline, so edits never modify the version a frame samples (see
+        // TimelineVersionSlot). Begin after setting up m_timeline's playback; End hands the clock back to m_timeline.
+        void BeginPlayingVersion() {
+            m_publishedTimeline.Clear();
+            m_playingTimeline = std::make_shared<Timeline>(m_timeline);
+        }
+        
+        void EndPlayingVersion() {
+            if (m_playingTimeline) {
+                m_timeline.ContinuePlayback(*m_playingTimeline);
+                m_playingTimeline.reset();
+            }
+            m_publishedTimeline.Clear();
+        }
+        
+        // The timeline whose clock is running: the playing version during playback, m_timeline otherwise
+        Timeline& GetPlaybackTimeline() { return m_playingTimeline ? *m_playingTimeline : m_timeline; }
+        const Timeline& GetPlaybackTimeline() const { return m_playingTimeline ? *m_playingTimeline : m_timeline; }
+        
+        // Copies identity and the persisted (YAML) fields, to write a file without holding a_other's lock
+        void CopyPersisted(const TimelineState& a_other) {
+            m_id = a_other.m_id;
+            m_ownerHandle = a_other.m_ownerHandle;
+            m_ownerName = a_other.m_ownerName;
+            m_timeline = a_other.m_timeline;
+            m_globalEaseIn = a_other.m_globalEaseIn;
+            m_globalEaseOut = a_other.m_globalEaseOut;
+            m_showMenusDuringPlayback = a_other.m_showMenusDuringPlayback;
+            m_allowUserRotation = a_other.m_allowUserRotation;
+            m_followGround = a_other.m_followGround;
+            m_minHeightAboveGround = a_other.m_minHeightAboveGround;
         }
     };
 
@@ -96,6 +141,12 @@ namespace FCFW {
             int AddRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_rotation, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode);
             int AddRotationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode);
             int AddFOVPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, float a_fov, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode);
+            // Batch variants: one lock, one sorted merge and one publish; return the new point count or -1
+            int AddTranslationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<const RE::NiPoint3> a_positions, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode);
+            int AddRotationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<const RE::NiPoint3> a_rotations, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode);
+            int AddFOVPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<const float> a_fovs, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode);
+            // Replaces all points with tracks built outside the lock (timeline builder), see Timeline::SwapPoints
+            bool SwapTimelinePoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, TranslationTrack& a_translationTrack, RotationTrack& a_rotationTrack, FOVTrack& a_fovTrack);
             
             bool RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index);
             bool RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index);
@@ -108,11 +159,19 @@ namespace FCFW {
             RE::NiPoint3 GetTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const;
             RE::NiPoint3 GetRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const;
             float GetFOVPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const;
+            bool GetTranslationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_positions) const;
+            bool GetRotationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_rotations) const;
+            bool GetFOVPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::vector<float>& a_times, std::vector<float>& a_fovs) const;
+            bool SampleTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<RE::NiPoint3> a_translations, std::span<RE::NiPoint3> a_rotations, std::span<float> a_fovs) const;
+            float GetTranslationPathLength(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const;
+            bool AutoRetimeByDistance(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID);
+            bool BakeTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_sampleRate, float a_tolerance = 0.0f);
+            bool IsTimelineBaked(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const;
             
             // playback / recording
             bool StartRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_recordingInterval = 1.0f, bool a_append = false, float a_timeOffset = 0.0f);
             bool StopRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID);
-            bool StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed = 1.0f, bool a_globalEaseIn = false, bool a_globalEaseOut = false, bool a_useDuration = false, float a_duration = 0.0f, float a_startTime = 0.0f);
+            bool StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed = 1.0f, bool a_globalEaseIn = false, bool a_globalEaseOut = false, bool a_useDuration = false, float a_duration = 0.0f, float a_startTime = 0.0f, bool a_constantSpeed = false);
             bool StopPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID);
             bool SwitchPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID);
             bool IsPlaybackRunning(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const;
@@ -136,6 +195,11 @@ namespace FCFW {
             bool AddTimelineFromFile(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath, float a_timeOffset = 0.0f); // Requires ownership
             bool ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const;
 
+            // queued calls, applied at the start of the next Update() (see TimelineCommandQueue.h)
+            uint64_t QueueCommand(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command);
+            FCFW_API::CommandStatus GetCommandResult(uint64_t a_ticket, int* a_result) const;
+            FCFW_API::CommandStatus WaitForCommand(uint64_t a_ticket, int* a_result, uint32_t a_timeoutMs) const;
+
             // Papyrus event registration
             void RegisterForTimelineEvents(RE::TESForm* a_form);
             void UnregisterForTimelineEvents(RE::TESForm* a_form);
@@ -146,34 +210,82 @@ namespace FCFW {
 
             void SetUserTurning(bool a_turning);
             
-            // Overloads for internal use (no ownership validation - for hooks)
-            bool IsPlaybackRunning(size_t a_timelineID) const;
-            bool IsUserRotationAllowed(size_t a_timelineID) const;
-            size_t GetActiveTimelineID() const { return m_activeTimelineID; }    
+            // Lock-free view of the active timeline (for hooks, see PlaybackStateWord.h)
+            PlaybackSnapshot GetPlaybackSnapshot() const { return m_playbackState.Load(); }
+            size_t GetActiveTimelineID() const { return m_playbackState.Load().m_activeTimelineID; }
                 
             // Save/load handlers
             void OnPreSaveGame();
-            void OnPostSaveGame();
 
             // Debug/testing
             void ToggleBodyPartRotationMatrixDisplay(RE::Actor* a_actor, BodyPart a_bodyPart);
+            bool StartFrameCapture(const char* a_filePath);  // Captures the next playback (see FrameCapture.h), path relative to Data
+            void StopFrameCapture();
+            bool StartTrace(const char* a_filePath);  // Chrome trace-event recording (see TraceRecorder.h), path relative to Data
+            bool FlushTrace();
+            void StopTrace();
 
         private:
             TimelineManager() = default;
             ~TimelineManager() = default;
             
-           void DispatchTimelineEvent(uint32_t a_messageType, size_t a_timelineID);
+           void DispatchTimelineEvent(uint32_t a_messageType, size_t a_timelineID);  // Deferred until the API call has released its locks
            void DispatchTimelineEventPapyrus(const char* a_eventName, size_t a_timelineID);
+            int ApplyCommand(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command);  // A queued call, through the API functions above
+
+            // Locked access to one owned timeline: holds m_timelinesMutex shared (the entry cannot be erased), then the
+            // timeline's lock shared for readers, its edit lock and its lock exclusively for writers, and only its edit lock
+            // for evaluators (m_stateLock stays empty). Empty if the timeline does not exist or is not owned by the caller.
+            template <class StateLock, class State>
+            struct TimelineAccess {
+                std::shared_lock<std::shared_mutex> m_mapLock;
+                std::unique_lock<std::mutex> m_editLock;
+                StateLock m_stateLock;
+                State* m_state = nullptr;
+
+                explicit operator bool() const { return m_state != nullptr; }
+                State* operator->() const { return m_state; }
+            };
+            using TimelineReader = TimelineAccess<std::shared_lock<std::shared_mutex>, const TimelineState>;
+            using TimelineWriter = TimelineAccess<std::unique_lock<std::shared_mutex>, TimelineState>;
+            using TimelineEvaluator = TimelineAccess<std::unique_lock<std::shared_mutex>, const TimelineState>;
 
+            TimelineReader ReadTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle) const;
+            TimelineWriter WriteTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle);
+            // Read-only access to m_timeline for sampling point values or curves, and for copying it. Evaluation fills the
+            // timeline's lazily built caches (segment polynomials, arc length table, resolved reference values, lookup
+            // cursors), so evaluators are serialized by the edit lock; the frame plays its own version under m_lock and
+            // does not wait for them. Besides m_timeline, only fields that change with the edit lock held may be read
+            // (persisted settings, m_isRecording), not the playback state.
+            TimelineEvaluator EvaluateTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle) const;
+            // Last step of an edit: releases the timeline's locks. a_version is the edited timeline if the caller already
+            // assembled it (see SwapTimelinePoints), otherwise m_timeline is copied.
+            void PublishEdit(TimelineWriter& a_state, std::shared_ptr<Timeline> a_version = nullptr);
+
+            // The *Locked helpers and everything below expect m_playbackMutex and the timeline's exclusive lock to be held,
+            // and the edit lock as well where they modify m_timeline (all but PlayTimeline)
+            void StopPlaybackLocked(TimelineState* a_state);
+            void StopRecordingLocked(TimelineState* a_state);
             void RecordTimeline(TimelineState* a_state);
-            void PlayTimeline(TimelineState* a_state);
+            // Outcome of one playback frame. kEnded: Update() stops playback as StopPlayback does. kAborted: free camera was
+            // left or is unavailable, playback was dropped without restoring the camera and Update() ends the playing version.
+            enum class PlaybackStep {
+                kContinue,
+                kEnded,
+                kAborted
+            };
+            PlaybackStep PlayTimeline(TimelineState* a_state);
+            void OnPostSaveGame();
             
            void CopyPlaybackState(TimelineState* a_fromState, TimelineState* a_toState);
+            void PublishPlaybackState(const TimelineState* a_activeState);  // After changing the active timeline or its flags (nullptr if none is active)
+            bool WriteTimelineFile(const TimelineState* a_state, const std::filesystem::path& a_fullPath) const;
 
+            // Lookup with ownership check, m_timelinesMutex must be held
             TimelineState* GetTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle);
             const TimelineState* GetTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle) const;
             
-            void CleanupPluginTimelines(SKSE::PluginHandle a_pluginHandle);
+            void CleanupPluginTimelines(SKSE::PluginHandle a_pluginHandle);  // m_playbackMutex and m_timelinesMutex (exclusive) must be held
 
             void PropagatePlayerIfNeeded(bool a_resetPosition = false);
             void DisablePlayerSim(bool a_disable);
@@ -189,15 +301,25 @@ namespace FCFW {
             void UpdateTerrainOcclusionForCamera(); // Update TVDT if camera moved to different cell
 /* END UNUSED */
 
+            // Locks, always taken in this order and never re-entered:
+            //   m_playbackMutex         - active timeline, playback globals and save state; held by Update() for a frame
+            //   m_timelinesMutex        - m_timelines and m_registeredPlugins; shared for lookups, exclusive to add/remove
+            //   TimelineState::m_editLock - one timeline's m_timeline, with m_lock to modify it or alone to evaluate or copy it
+            //   TimelineState::m_lock   - one timeline's data (exclusive m_timelinesMutex covers all timelines)
+            //   m_eventReceiversMutex   - Papyrus event receivers, leaf lock
+            mutable std::mutex m_playbackMutex;
+            mutable std::shared_mutex m_timelinesMutex;
+
             std::unordered_set<SKSE::PluginHandle> m_registeredPlugins;
             std::unordered_map<size_t, TimelineState> m_timelines;
-            mutable std::recursive_mutex m_timelineMutex;  // Protect map operations (recursive for reentrant safety)
             std::atomic<size_t> m_nextTimelineID = 1;     // ID generator
             size_t m_activeTimelineID = 0;
+            PlaybackStateWord m_playbackState;            // Published copy of the active timeline's state
+            TimelineCommandQueue m_commandQueue;          // API calls queued by other threads, drained by Update()
                         
             // Playback
             bool m_isShowingMenus = true;         // Whether menus were showing before playback started
-            bool m_userTurning = false;           // Whether user is manually controlling camera during playback
+            std::atomic<bool> m_userTurning = false; // Whether user is manually controlling camera during playback (set by the look hook)
             RE::NiPoint2 m_lastFreeRotation;      // camera free rotation before playback started (third-person only)
             RE::NiPoint3 m_initialPlayerPosition; // Player position at start of playback
             bool m_isPlayerMoved = false;   // Whether player is moved to camera position during playback
@@ -213,13 +335,14 @@ namespace FCFW {
 
             // Papyrus event registration
             std::vector<RE::TESForm*> m_eventReceivers;  // Forms registered for timeline events
+            std::mutex m_eventReceiversMutex;
             
             // Savegame handling
             bool m_isSaveInProgress = false;    // Flag to indicate save is in progress
 
             // Debug/testing
             void UpdateBodyPartRotationMatrixDisplay();
-            bool m_displayRotationMatrix = false;
+            std::atomic<bool> m_displayRotationMatrix = false;  // Read by Update() before taking the lock
             RE::Actor* m_rotationMatrixActor = nullptr;
             BodyPart m_rotationMatrixBodyPart = BodyPart::kHead;
     }; // class TimelineManager
@@ -6,6 +6,9 @@
 
 namespace FCFW
 {
+	// Keyframe curve of one camera channel. Tracks hold no playback state: Timeline's TimelineClock
+	// owns the playback time and tracks evaluate whatever time they are asked for. The playback mode
+	// and loop offset only shape the virtual loop segment (last point back to the first).
 	template <typename PathType>
 	class TimelineTrack
 	{
@@ -13,26 +16,43 @@ namespace FCFW
 		using TransitionPoint = typename PathType::TransitionPoint;
 
 		TimelineTrack() = default;
+		TimelineTrack(const TimelineTrack&) = default;
+		TimelineTrack(TimelineTrack&&) noexcept = default;
+		TimelineTrack& operator=(const TimelineTrack&) = default;
+		TimelineTrack& operator=(TimelineTrack&&) noexcept = default;
 		~TimelineTrack() = default;
 
 		void AddPoint(const TransitionPoint& a_point);
+		void AddPoints(std::span<const TransitionPoint> a_points);  // One sorted merge (see CameraPath::AddPoints)
 		void RemovePoint(size_t a_index);
 		void ClearPoints();
 
-		void UpdateTimeline(float a_deltaTime);
-		void StartPlayback();
-		void ResetTimeline();
-		void PausePlayback();
-		void ResumePlayback();
-
 		typename PathType::ValueType GetPointAtTime(float a_time) const;
+		// Evaluates a_times[a_order[i]] into a_out[a_order[i]]; a_order must visit the times in ascending order
+		void SampleBatch(std::span<const float> a_times, std::span<const size_t> a_order, std::span<typename PathType::ValueType> a_out) const;
+
+		// Shared-key evaluation (see SharedKeyBlock): key of the segment ending at point a_index, and what evaluating that
+		// segment computes on a track without kReference points - a polynomial in the eased progress (true) or a_value (false)
+		size_t GetSegmentKey(size_t a_index) const { return m_path.GetSegmentKey(a_index, m_playbackMode == PlaybackMode::kLoop); }
+		bool GetSegmentEvaluation(size_t a_index, typename TransitionPoint::SegmentCoefficients& a_coefficients, typename PathType::ValueType& a_value) const;
+
+		// Arc length parameterization (translation tracks). The cumulative length table is built on first use
+		// after an edit; holds (kNone), constant segments and segments touching kReference points have zero length.
+		float GetPathLength() const;
+		float GetSegmentLength(size_t a_index) const;  // Segment ending at point a_index
+		typename PathType::ValueType GetPointAtDistance(float a_distance) const;
+		// Constant speed: maps a_time linearly from [first point time, duration] onto [0, path length]
+		typename PathType::ValueType GetPointAtTimeConstantSpeed(float a_time) const;
+		// Moves every point time through a non-decreasing mapping
+		template <typename TimeMap>
+		void RemapPointTimes(TimeMap&& a_map);
 
 		size_t GetPointCount() const;
+		float GetPointTime(size_t a_index) const { return m_path.GetPointTime(a_index); }
+		// Sparse per-axis keys (see CameraPath::AddChannels); the points mirror them at the union of the key times
+		bool IsChannelized() const { return m_path.IsChannelized(); }
+		bool HasPointType(PointType a_type) const;
 		float GetDuration() const;
-		float GetPlaybackTime() const { return m_playbackTime; }
-		void SetPlaybackTime(float a_time) { m_playbackTime = std::clamp(a_time, 0.0f, GetDuration()); }
-		bool IsPlaying() const { return m_isPlaying; }
-		bool IsPaused() const { return m_isPaused; }
 
 		void SetPlaybackMode(PlaybackMode a_mode);
 		PlaybackMode GetPlaybackMode() const { return m_playbackMode; }
@@ -43,7 +63,10 @@ namespace FCFW
 		void UpdateCameraPoints();
 
 		TransitionPoint GetPointAtCamera(float a_time, bool a_easeIn, bool a_easeOut) const;
-		const TransitionPoint& GetPoint(size_t a_index) const;
+		// Returns a copy, no longer a const reference into the track (see CameraPath::GetPoint)
+		TransitionPoint GetPoint(size_t a_index) const;
+		// Times and current values of all points (kReference points resolved), without assembling point objects
+		void GetPoints(std::vector<float>& a_times, std::vector<typename PathType::ValueType>& a_values) const;
 		
 		bool AddPathFromFile(const std::string& a_filePath, float a_timeOffset = 0.0f, float a_conversionFactor = 1.0f);
 		bool ExportPath(std::ofstream& a_file, float a_conversionFactor = 1.0f) const;
@@ -52,13 +75,28 @@ namespace FCFW
 		typename PathType::ValueType GetInterpolatedPoint(size_t a_index, float a_progress) const;
 		typename PathType::ValueType GetPointLinear(size_t a_index, float a_progress) const;
 		typename PathType::ValueType GetPointCubicHermite(size_t a_index, float a_progress) const;
+		bool GetSegmentPolynomial(size_t a_index, typename TransitionPoint::SegmentCoefficients& a_coefficients) const;
+		void GetSegmentAtTime(float a_time, size_t& a_index, float& a_progress) const;
+		size_t FindSegment(float a_time) const;
+		typename PathType::ValueType EvaluateChannels(float a_time) const;
+		void GetSegmentAtDistance(float a_distance, size_t& a_index, float& a_progress) const;
+		void BuildArcLengthTable() const;
+
+		// Cumulative distance at evenly spaced parameters of each segment, ascending in distance
+		struct ArcLengthSample {
+			float m_distance;
+			std::uint32_t m_segment;
+			float m_progress;
+		};
+		static constexpr size_t kArcLengthSubdivisions = 16;  // Table entries per segment (quadrature intervals)
 
 		PathType m_path;                          // CameraPath<TransitionPoint> - stores ordered points
-		float m_playbackTime{ 0.0f };             // Current position in timeline (seconds)
-		bool m_isPlaying{ false };                // Playback active
-		bool m_isPaused{ false };                 // Playback paused
-		PlaybackMode m_playbackMode{ PlaybackMode::kEnd };  // kEnd (stop) or kLoop (wrap)
+		PlaybackMode m_playbackMode{ PlaybackMode::kEnd };  // kLoop adds the virtual loop segment
 		float m_loopTimeOffset{ 0.0f };           // Extra time for loop interpolation (last→first)
+		mutable size_t m_segmentCursor{ 0 };      // Segment found by the last lookup (playback locality hint)
+		mutable std::vector<ArcLengthSample> m_arcLengthTable;
+		mutable std::vector<float> m_segmentLengths;  // Indexed by segment end point
+		mutable bool m_arcLengthValid{ false };       // Cleared by every edit, rebuilt on demand
 	};
 
 	using TranslationTrack = TimelineTrack<TranslationPath>;
@@ -69,148 +107,220 @@ namespace FCFW
 	void TimelineTrack<PathType>::AddPoint(const TransitionPoint& a_point)
 	{
 		m_path.AddPoint(a_point);
-		ResetTimeline();
+		m_segmentCursor = 0;
+		m_arcLengthValid = false;
+	}
+
+	template <typename PathType>
+	void TimelineTrack<PathType>::AddPoints(std::span<const TransitionPoint> a_points)
+	{
+		m_path.AddPoints(a_points);
+		m_segmentCursor = 0;
+		m_arcLengthValid = false;
 	}
 
 	template <typename PathType>
 	void TimelineTrack<PathType>::RemovePoint(size_t a_index)
 	{
 		m_path.RemovePoint(a_index);
-		ResetTimeline();
+		m_segmentCursor = 0;
+		m_arcLengthValid = false;
 	}
 
 	template <typename PathType>
 	void TimelineTrack<PathType>::ClearPoints()
 	{
 		m_path.ClearPath();
-		ResetTimeline();
+		m_segmentCursor = 0;
 		m_playbackMode = PlaybackMode::kEnd;
+		m_arcLengthValid = false;
 	}
 
 	template <typename PathType>
-	void TimelineTrack<PathType>::UpdateTimeline(float a_deltaTime)
+	typename PathType::ValueType TimelineTrack<PathType>::GetPointAtTime(float a_time) const
 	{
-		if (m_isPaused || !m_isPlaying) {
-			return;
+		auto pointCount = GetPointCount();
+		if (pointCount == 0) {
+			return TransitionPoint{}.GetPoint();
+		}
+		if (m_path.IsChannelized()) {
+			return EvaluateChannels(a_time);
 		}
 
-		size_t pointCount = GetPointCount();
+		// Calculate state for requested time
+		size_t index = 0;
+		float progress = 0.0f;
+		GetSegmentAtTime(a_time, index, progress);
+
+		// Get interpolated point for requested time
+		return GetInterpolatedPoint(index, progress);
+	}
+
+	template <typename PathType>
+	void TimelineTrack<PathType>::SampleBatch(std::span<const float> a_times, std::span<const size_t> a_order, std::span<typename PathType::ValueType> a_out) const
+	{
+		using Coefficients = typename TransitionPoint::SegmentCoefficients;
+		constexpr size_t channelCount = std::tuple_size_v<Coefficients>;
+
+		const size_t pointCount = GetPointCount();
 		if (pointCount == 0) {
-			m_isPlaying = false;
+			std::fill(a_out.begin(), a_out.end(), TransitionPoint{}.GetPoint());
 			return;
 		}
+		if (m_path.IsChannelized()) {
+			for (size_t i = 0; i < a_order.size(); ++i) {
+				a_out[a_order[i]] = EvaluateChannels(a_times[a_order[i]]);
+			}
+			return;
+		}
+
+		// Ascending times walk the segments forward, so FindSegment stays on its cursor fast path.
+		// The cursor is restored afterwards so sampling does not disturb playback lookups.
+		const size_t sampleCount = a_order.size();
+		std::vector<size_t> indices(sampleCount);
+		std::vector<float> progress(sampleCount);
+		const size_t savedCursor = m_segmentCursor;
+		for (size_t i = 0; i < sampleCount; ++i) {
+			GetSegmentAtTime(a_times[a_order[i]], indices[i], progress[i]);
+		}
+		m_segmentCursor = savedCursor;
+
+		std::vector<float> t;
+		std::array<std::vector<float>, channelCount> channels;
+		Coefficients coefficients{};
+
+		// Samples in the same segment share one polynomial per channel: evaluate each run with the SIMD kernel
+		size_t runStart = 0;
+		while (runStart < sampleCount) {
+			const size_t index = indices[runStart];
+			size_t runEnd = runStart + 1;
+			while (runEnd < sampleCount && indices[runEnd] == index) {
+				++runEnd;
+			}
 
-		m_playbackTime += a_deltaTime;
+			if (!GetSegmentPolynomial(index, coefficients)) {
+				for (size_t i = runStart; i < runEnd; ++i) {
+					a_out[a_order[i]] = GetInterpolatedPoint(index, progress[i]);
+				}
+				runStart = runEnd;
+				continue;
+			}
 
-		// Get timeline duration (includes loop offset if in loop mode)
-		float timelineDuration = GetDuration();
+			// Easing comes from the segment's end point (point 0 for the virtual loop segment)
+			const size_t easeIdx = index < pointCount ? index : 0;
+			const bool easeIn = m_path.GetPointEaseIn(easeIdx);
+			const bool easeOut = m_path.GetPointEaseOut(easeIdx);
 
-		// Check for completion and handle based on playback mode
-		if (m_playbackTime >= timelineDuration) {
-			if (m_playbackMode == PlaybackMode::kLoop) {
-				// Loop: use modulo to wrap time seamlessly
-				m_playbackTime = std::fmod(m_playbackTime, timelineDuration);
-			} else if (m_playbackMode == PlaybackMode::kWait) {
-				m_playbackTime = timelineDuration;
-			} else {
-				// End: clamp to final position and stop
-				m_playbackTime = timelineDuration;
-				m_isPlaying = false;
+			const size_t runLength = runEnd - runStart;
+			t.resize(runLength);
+			for (size_t i = 0; i < runLength; ++i) {
+				t[i] = _ts_SKSEFunctions::ApplyEasing(progress[runStart + i], easeIn, easeOut);
 			}
+			for (size_t c = 0; c < channelCount; ++c) {
+				channels[c].resize(runLength);
+				EvaluateCubicBatch(coefficients[c], t, channels[c]);
+			}
+
+			float sample[channelCount];
+			for (size_t i = 0; i < runLength; ++i) {
+				for (size_t c = 0; c < channelCount; ++c) {
+					sample[c] = channels[c][i];
+				}
+				a_out[a_order[runStart + i]] = TransitionPoint::ValueFromChannels(sample);
+			}
+			runStart = runEnd;
 		}
 	}
 
 	template <typename PathType>
-	void TimelineTrack<PathType>::StartPlayback()
+	void TimelineTrack<PathType>::GetSegmentAtTime(float a_time, size_t& a_index, float& a_progress) const
 	{
-		m_path.UpdateCameraPoints();  // Store current camera values for kCamera points
-		m_isPlaying = true;
-		m_isPaused = false;
+		const size_t pointCount = GetPointCount();
+		float lastPointTime = m_path.GetPointTime(pointCount - 1);
+
+		// Check if we're in the virtual loop segment (after last point)
+		if (m_playbackMode == PlaybackMode::kLoop && m_loopTimeOffset > 0.0f && a_time > lastPointTime) {
+			a_index = pointCount;  // Virtual index beyond last point
+			a_progress = (a_time - lastPointTime) / m_loopTimeOffset;
+			a_progress = std::clamp(a_progress, 0.0f, 1.0f);
+			return;
+		}
+
+		// Find the segment containing this time
+		size_t targetIndex = FindSegment(a_time);
+
+		if (targetIndex >= pointCount) {
+			a_index = pointCount - 1;
+			a_progress = 1.0f;
+			return;
+		}
+
+		// Calculate progress within this segment
+		a_index = targetIndex;
+		a_progress = 0.0f;
+		if (targetIndex > 0) {
+			float prevTime = m_path.GetPointTime(targetIndex - 1);
+			float segmentDuration = m_path.GetPointTime(targetIndex) - prevTime;
+			if (segmentDuration > 0.0f) {
+				a_progress = (a_time - prevTime) / segmentDuration;
+				a_progress = std::clamp(a_progress, 0.0f, 1.0f);
+			} else {
+				a_progress = 1.0f;
+			}
+		}
 	}
 
 	template <typename PathType>
-	void TimelineTrack<PathType>::ResetTimeline()
+	size_t TimelineTrack<PathType>::FindSegment(float a_time) const
 	{
-		m_playbackTime = 0.0f;
-		m_isPlaying = false;
-		m_isPaused = false;
+		// First point index with time >= a_time (pointCount if past the last point).
+		// During playback this is almost always the cursor segment or the one right after it,
+		// so check those first and only binary search after a jump.
+		const size_t pointCount = GetPointCount();
+		auto containsTime = [&](size_t a_index) {
+			if (a_index > pointCount) {
+				return false;
+			}
+			bool afterPrev = a_index == 0 || m_path.GetPointTime(a_index - 1) < a_time;
+			bool notAfterCurrent = a_index == pointCount || a_time <= m_path.GetPointTime(a_index);
+			return afterPrev && notAfterCurrent;
+		};
+
+		if (containsTime(m_segmentCursor)) {
+			return m_segmentCursor;
+		}
+		if (containsTime(m_segmentCursor + 1)) {
+			return ++m_segmentCursor;
+		}
+
+		FrameProfiler::Count(FrameCounter::kSegmentSearches);
+		m_segmentCursor = m_path.FindSegmentIndex(a_time);
+		return m_segmentCursor;
 	}
 
 	template <typename PathType>
-	void TimelineTrack<PathType>::PausePlayback()
+	typename PathType::ValueType TimelineTrack<PathType>::EvaluateChannels(float a_time) const
 	{
-		m_isPaused = true;
+		// Every axis gets the same loop segment end as the mirrored points: last key time + loop offset
+		const bool hasLoopSegment = m_playbackMode == PlaybackMode::kLoop && m_loopTimeOffset > 0.0f;
+		return m_path.EvaluateChannels(a_time, m_playbackMode == PlaybackMode::kLoop, hasLoopSegment ? GetDuration() : 0.0f);
 	}
 
 	template <typename PathType>
-	void TimelineTrack<PathType>::ResumePlayback()
+	size_t TimelineTrack<PathType>::GetPointCount() const
 	{
-		m_isPaused = false;
+		return m_path.GetPointCount();
 	}
 
 	template <typename PathType>
-	typename PathType::ValueType TimelineTrack<PathType>::GetPointAtTime(float a_time) const
+	bool TimelineTrack<PathType>::HasPointType(PointType a_type) const
 	{
-		auto pointCount = GetPointCount();
-		if (pointCount == 0) {
-			return TransitionPoint{}.GetPoint();
-		}
-
-		// Calculate state for requested time
-		size_t index = 0;
-		float progress = 0.0f;
-
-		// Calculate segment state (index and progress)
-		float lastPointTime = m_path.GetPoint(pointCount - 1).m_transition.m_time;
-
-		// Check if we're in the virtual loop segment (after last point)
-		if (m_playbackMode == PlaybackMode::kLoop && m_loopTimeOffset > 0.0f && a_time > lastPointTime) {
-			index = pointCount;  // Virtual index beyond last point
-			progress = (a_time - lastPointTime) / m_loopTimeOffset;
-			progress = std::clamp(progress, 0.0f, 1.0f);
-		} else {  // Find the segment containing this time
-			size_t targetIndex = 0;
-			for (size_t i = 0; i < pointCount; ++i) {
-				const auto& point = m_path.GetPoint(i);
-				if (a_time <= point.m_transition.m_time) {
-					targetIndex = i;
-					break;
-				}
-				targetIndex = i + 1;
-			}
-
-			if (targetIndex >= pointCount) {
-				targetIndex = pointCount - 1;
-				index = targetIndex;
-				progress = 1.0f;
-			} else {
-				// Calculate progress within this segment
-				index = targetIndex;
-
-				if (targetIndex > 0) {
-					const auto& prevPoint = m_path.GetPoint(targetIndex - 1);
-					const auto& currentPoint = m_path.GetPoint(targetIndex);
-					float segmentDuration = currentPoint.m_transition.m_time - prevPoint.m_transition.m_time;
-					if (segmentDuration > 0.0f) {
-						progress = (a_time - prevPoint.m_transition.m_time) / segmentDuration;
-						progress = std::clamp(progress, 0.0f, 1.0f);
-					} else {
-						progress = 1.0f;
-					}
-				} else {
-					progress = 0.0f;
-				}
+		for (size_t i = 0; i < GetPointCount(); ++i) {
+			if (m_path.GetPointType(i) == a_type) {
+				return true;
 			}
 		}
-
-		// Get interpolated point for requested time
-		return GetInterpolatedPoint(index, progress);
-	}
-
-	template <typename PathType>
-	size_t TimelineTrack<PathType>::GetPointCount() const
-	{
-		return m_path.GetPointCount();
+		return false;
 	}
 
 	template <typename PathType>
@@ -220,7 +330,7 @@ namespace FCFW
 		if (pointCount == 0) {
 			return 0.0f;
 		}
-		float lastPointTime = m_path.GetPoint(pointCount - 1).m_transition.m_time;
+		float lastPointTime = m_path.GetPointTime(pointCount - 1);
 		// In loop mode, add offset to create interpolation time from last to first point
 		if (m_playbackMode == PlaybackMode::kLoop) {
 			return lastPointTime + m_loopTimeOffset;
@@ -232,18 +342,157 @@ namespace FCFW
 	void TimelineTrack<PathType>::SetPlaybackMode(PlaybackMode a_mode)
 	{
 		m_playbackMode = a_mode;
+		m_arcLengthValid = false;
 	}
 
 	template <typename PathType>
 	void TimelineTrack<PathType>::SetLoopTimeOffset(float a_offset)
 	{
 		m_loopTimeOffset = a_offset;
+		m_arcLengthValid = false;
 	}
 
 	template <typename PathType>
 	void TimelineTrack<PathType>::UpdateCameraPoints()
 	{
 		m_path.UpdateCameraPoints();
+		m_arcLengthValid = false;
+	}
+
+	template <typename PathType>
+	template <typename TimeMap>
+	void TimelineTrack<PathType>::RemapPointTimes(TimeMap&& a_map)
+	{
+		m_path.RemapTimes(std::forward<TimeMap>(a_map));
+		m_segmentCursor = 0;
+		m_arcLengthValid = false;
+	}
+
+	template <typename PathType>
+	float TimelineTrack<PathType>::GetPathLength() const
+	{
+		if (!m_arcLengthValid) {
+			BuildArcLengthTable();
+		}
+		return m_arcLengthTable.empty() ? 0.0f : m_arcLengthTable.back().m_distance;
+	}
+
+	template <typename PathType>
+	float TimelineTrack<PathType>::GetSegmentLength(size_t a_index) const
+	{
+		if (!m_arcLengthValid) {
+			BuildArcLengthTable();
+		}
+		return a_index < m_segmentLengths.size() ? m_segmentLengths[a_index] : 0.0f;
+	}
+
+	template <typename PathType>
+	typename PathType::ValueType TimelineTrack<PathType>::GetPointAtDistance(float a_distance) const
+	{
+		const size_t pointCount = GetPointCount();
+		if (pointCount == 0) {
+			return typename PathType::ValueType{};
+		}
+		if (pointCount == 1) {
+			return m_path.GetPointValue(0);
+		}
+
+		size_t index;
+		float progress;
+		GetSegmentAtDistance(a_distance, index, progress);
+
+		// The table is in curve parameter space, so evaluate the polynomial directly (segment easing would distort it)
+		typename TransitionPoint::SegmentCoefficients coefficients;
+		if (GetSegmentPolynomial(index, coefficients)) {
+			return TransitionPoint::EvaluateSegment(coefficients, progress);
+		}
+		return GetInterpolatedPoint(index, progress);
+	}
+
+	template <typename PathType>
+	typename PathType::ValueType TimelineTrack<PathType>::GetPointAtTimeConstantSpeed(float a_time) const
+	{
+		const size_t pointCount = GetPointCount();
+		if (pointCount == 0) {
+			return typename PathType::ValueType{};
+		}
+
+		const float startTime = m_path.GetPointTime(0);
+		const float endTime = GetDuration();
+		const float progress = endTime > startTime ? std::clamp((a_time - startTime) / (endTime - startTime), 0.0f, 1.0f) : 1.0f;
+		return GetPointAtDistance(progress * GetPathLength());
+	}
+
+	template <typename PathType>
+	void TimelineTrack<PathType>::GetSegmentAtDistance(float a_distance, size_t& a_index, float& a_progress) const
+	{
+		if (!m_arcLengthValid) {
+			BuildArcLengthTable();
+		}
+
+		// Binary search for the first entry past a_distance; zero length segments are skipped over
+		auto it = std::upper_bound(m_arcLengthTable.begin(), m_arcLengthTable.end(), a_distance,
+			[](float distance, const ArcLengthSample& sample) {
+				return distance < sample.m_distance;
+			});
+		if (it == m_arcLengthTable.begin() || it == m_arcLengthTable.end()) {
+			const ArcLengthSample& sample = it == m_arcLengthTable.end() ? m_arcLengthTable.back() : *it;
+			a_index = sample.m_segment;
+			a_progress = sample.m_progress;
+			return;
+		}
+
+		const ArcLengthSample& prev = *(it - 1);
+		a_index = prev.m_segment;
+		if (prev.m_segment != it->m_segment) {
+			a_progress = prev.m_progress;
+			return;
+		}
+		const float fraction = (a_distance - prev.m_distance) / (it->m_distance - prev.m_distance);
+		a_progress = prev.m_progress + (it->m_progress - prev.m_progress) * fraction;
+
+		// One Newton step on the exact length within the table interval corrects for speed changes inside it
+		typename TransitionPoint::SegmentCoefficients coefficients;
+		if (GetSegmentPolynomial(a_index, coefficients)) {
+			const float speed = ComputeCurveSpeed(coefficients, a_progress);
+			if (speed > EPSILON_COMPARISON) {
+				const float error = prev.m_distance + ComputeArcLength(coefficients, prev.m_progress, a_progress) - a_distance;
+				a_progress = std::clamp(a_progress - error / speed, prev.m_progress, it->m_progress);
+			}
+		}
+	}
+
+	template <typename PathType>
+	void TimelineTrack<PathType>::BuildArcLengthTable() const
+	{
+		const size_t pointCount = GetPointCount();
+		m_arcLengthTable.clear();
+		m_segmentLengths.assign(pointCount + 1, 0.0f);
+		m_arcLengthValid = true;
+		if (pointCount < 2) {
+			return;
+		}
+
+		// Same segment range as GetSegmentAtTime: the virtual loop segment only exists with a loop time offset
+		const bool hasLoopSegment = m_playbackMode == PlaybackMode::kLoop && m_loopTimeOffset > 0.0f;
+		const size_t lastSegment = hasLoopSegment ? pointCount : pointCount - 1;
+		m_arcLengthTable.reserve(lastSegment * (kArcLengthSubdivisions + 1));
+
+		float distance = 0.0f;
+		for (size_t index = 1; index <= lastSegment; ++index) {
+			typename TransitionPoint::SegmentCoefficients coefficients;
+			const bool hasPolynomial = GetSegmentPolynomial(index, coefficients);
+			const float segmentStart = distance;
+			for (size_t step = 0; step <= kArcLengthSubdivisions; ++step) {
+				const float progress = static_cast<float>(step) / static_cast<float>(kArcLengthSubdivisions);
+				if (step > 0 && hasPolynomial) {
+					const float prevProgress = static_cast<float>(step - 1) / static_cast<float>(kArcLengthSubdivisions);
+					distance += ComputeArcLength(coefficients, prevProgress, progress);
+				}
+				m_arcLengthTable.push_back({ distance, static_cast<std::uint32_t>(index), progress });
+			}
+			m_segmentLengths[index] = distance - segmentStart;
+		}
 	}
 
 	template <typename PathType>
@@ -258,11 +507,9 @@ namespace FCFW
 			currentIdx = GetPointCount() - 1;
 		}
 
-		const auto& currentPoint = m_path.GetPoint(currentIdx);
-
-		switch (currentPoint.m_transition.m_mode) {
+		switch (m_path.GetPointMode(currentIdx)) {
 			case InterpolationMode::kNone:
-				return currentPoint.GetPoint();
+				return m_path.GetPointValue(currentIdx);
 			case InterpolationMode::kLinear:
 				return GetPointLinear(a_index, a_progress);
 			case InterpolationMode::kCubicHermite:
@@ -293,27 +540,34 @@ namespace FCFW
 			currentIdx = pointCount - 1;
 		}
 
-		const auto& currentPoint = m_path.GetPoint(currentIdx);
-
 		// For virtual segment or normal segments starting after point 0
 		if (currentIdx == 0 && !isVirtualSegment) {
-			return currentPoint.GetPoint();
+			return m_path.GetPointValue(currentIdx);
+		}
+
+		float t = _ts_SKSEFunctions::ApplyEasing(a_progress,
+			m_path.GetPointEaseIn(currentIdx),
+			m_path.GetPointEaseOut(currentIdx));
+
+		// Segments between world/camera points are precomputed polynomials
+		const size_t segmentIdx = isVirtualSegment ? pointCount : currentIdx;
+		if (const auto* segment = m_path.GetHermiteSegment(segmentIdx, m_playbackMode == PlaybackMode::kLoop)) {
+			if (segment->m_isConstant) {
+				return segment->m_constantValue;
+			}
+			return TransitionPoint::EvaluateSegment(segment->m_coefficients, t);
 		}
 
 		// Get previous point (for virtual segment, it's the last point)
-		const auto& prevPoint = isVirtualSegment ? m_path.GetPoint(pointCount - 1) : m_path.GetPoint(currentIdx - 1);
+		const auto currentValue = m_path.GetPointValue(currentIdx);
+		const auto prevValue = m_path.GetPointValue(isVirtualSegment ? pointCount - 1 : currentIdx - 1);
 
-		if (prevPoint.IsNearlyEqual(currentPoint)) {
-			return currentPoint.GetPoint();
+		if (TransitionPoint::ValuesNearlyEqual(prevValue, currentValue)) {
+			return currentValue;
 		}
 
-		float t = _ts_SKSEFunctions::ApplyEasing(a_progress,
-			currentPoint.m_transition.m_easeIn,
-			currentPoint.m_transition.m_easeOut);
-
-		// Use the LinearInterpolate method which handles angular wrapping for rotation
-		TransitionPoint result = prevPoint.LinearInterpolate(prevPoint, currentPoint, t);
-		return result.GetPoint();
+		// InterpolateLinear takes the shortest arc for rotation
+		return TransitionPoint::InterpolateLinear(prevValue, currentValue, t);
 	}
 
 	template <typename PathType>
@@ -326,7 +580,7 @@ namespace FCFW
 		}
 
 		if (pointCount == 1) {
-			return m_path.GetPoint(0).GetPoint();
+			return m_path.GetPointValue(0);
 		}
 
 		size_t currentIdx = a_index;
@@ -338,48 +592,99 @@ namespace FCFW
 		}
 
 		if (currentIdx >= pointCount) {
-			return m_path.GetPoint(pointCount - 1).GetPoint();
+			return m_path.GetPointValue(pointCount - 1);
 		}
 
 		// For virtual segment or normal segments starting after point 0
 		if (currentIdx == 0 && !isVirtualSegment) {
-			return m_path.GetPoint(0).GetPoint();
+			return m_path.GetPointValue(0);
 		}
 
-		const auto& currentPoint = m_path.GetPoint(currentIdx);
-		// Get previous point (for virtual segment, it's the last point)
-		const auto& prevPoint = isVirtualSegment ? m_path.GetPoint(pointCount - 1) : m_path.GetPoint(currentIdx - 1);
+		const bool isLoop = m_playbackMode == PlaybackMode::kLoop;
+		float t = _ts_SKSEFunctions::ApplyEasing(a_progress,
+			m_path.GetPointEaseIn(currentIdx),
+			m_path.GetPointEaseOut(currentIdx));
 
-		if (prevPoint.IsNearlyEqual(currentPoint)) {
-			return prevPoint.GetPoint();
+		// Segments with only world/camera control points are precomputed polynomials
+		if (const auto* segment = m_path.GetHermiteSegment(a_index, isLoop)) {
+			if (segment->m_isConstant) {
+				return segment->m_constantValue;
+			}
+			return TransitionPoint::EvaluateSegment(segment->m_coefficients, t);
 		}
 
-		// Get neighboring points for tangent computation
-		TransitionPoint pt0, pt1, pt2, pt3;
+		// Get neighboring points for tangent computation (loop mode wraps, end mode clamps at the boundaries).
+		// For the virtual segment the previous point is the last point.
+		auto indices = m_path.GetHermiteControlIndices(a_index, isLoop);
+		const auto prevValue = m_path.GetPointValue(indices[1]);
+		const auto currentValue = m_path.GetPointValue(indices[2]);
 
-		if (m_playbackMode == PlaybackMode::kLoop) {
-			// Loop mode: modulo all indices to wrap around
-			pt0 = m_path.GetPoint((currentIdx - 2 + pointCount) % pointCount);
-			pt1 = m_path.GetPoint((currentIdx - 1 + pointCount) % pointCount);
-			pt2 = m_path.GetPoint(currentIdx % pointCount);
-			pt3 = m_path.GetPoint((currentIdx + 1) % pointCount);
-		} else {
-			// End mode: use boundary clamping
-			bool hasP0 = currentIdx >= 2;
-			bool hasP3 = currentIdx + 1 < pointCount;
-
-			pt0 = hasP0 ? m_path.GetPoint(currentIdx - 2) : prevPoint;
-			pt1 = prevPoint;
-			pt2 = currentPoint;
-			pt3 = hasP3 ? m_path.GetPoint(currentIdx + 1) : currentPoint;
+		if (TransitionPoint::ValuesNearlyEqual(prevValue, currentValue)) {
+			return prevValue;
 		}
 
-		float t = _ts_SKSEFunctions::ApplyEasing(a_progress,
-			currentPoint.m_transition.m_easeIn,
-			currentPoint.m_transition.m_easeOut);
+		return TransitionPoint::InterpolateCubic(m_path.GetPointValue(indices[0]), prevValue, currentValue,
+			m_path.GetPointValue(indices[3]), t);
+	}
+
+	template <typename PathType>
+	bool TimelineTrack<PathType>::GetSegmentPolynomial(size_t a_index, typename TransitionPoint::SegmentCoefficients& a_coefficients) const
+	{
+		// Mirrors the branches of GetPointLinear/GetPointCubicHermite: returns false whenever those
+		// would not evaluate a cached polynomial (holds, constant segments, reference segments, channelized paths)
+		const size_t pointCount = GetPointCount();
+		if (pointCount < 2 || a_index == 0 || m_path.IsChannelized()) {
+			return false;
+		}
+
+		const bool isLoop = m_playbackMode == PlaybackMode::kLoop;
+		const bool isVirtualSegment = isLoop && a_index == pointCount;
+		if (a_index >= pointCount && !isVirtualSegment) {
+			return false;
+		}
 
-		TransitionPoint result = pt1.CubicHermite(pt0, pt1, pt2, pt3, t);
-		return result.GetPoint();
+		if (m_path.GetPointMode(std::min(a_index, pointCount - 1)) == InterpolationMode::kNone) {
+			return false;
+		}
+
+		const auto* segment = m_path.GetHermiteSegment(a_index, isLoop);
+		if (!segment || segment->m_isConstant) {
+			return false;
+		}
+		a_coefficients = segment->m_coefficients;
+		return true;
+	}
+
+	template <typename PathType>
+	bool TimelineTrack<PathType>::GetSegmentEvaluation(size_t a_index, typename TransitionPoint::SegmentCoefficients& a_coefficients, typename PathType::ValueType& a_value) const
+	{
+		// Mirrors GetInterpolatedPoint for a_index in [0, pointCount - 1] plus the virtual loop segment
+		const size_t pointCount = GetPointCount();
+		if (pointCount == 0) {
+			a_value = TransitionPoint{}.GetPoint();
+			return false;
+		}
+		if (pointCount == 1 || a_index == 0) {
+			a_value = m_path.GetPointValue(0);
+			return false;
+		}
+
+		const bool isLoop = m_playbackMode == PlaybackMode::kLoop;
+		if (static_cast<InterpolationMode>(GetSegmentKey(a_index) & PathType::kModeMask) == InterpolationMode::kNone) {
+			a_value = m_path.GetPointValue(std::min(a_index, pointCount - 1));
+			return false;
+		}
+		const auto* segment = m_path.GetHermiteSegment(a_index, isLoop);
+		if (!segment) {
+			a_value = m_path.GetPointValue(std::min(a_index, pointCount - 1));
+			return false;
+		}
+		if (segment->m_isConstant) {
+			a_value = segment->m_constantValue;
+			return false;
+		}
+		a_coefficients = segment->m_coefficients;
+		return true;
 	}
 
 	template <typename PathType>
@@ -389,14 +694,27 @@ namespace FCFW
 	}
 
 	template <typename PathType>
-	const typename PathType::TransitionPoint& TimelineTrack<PathType>::GetPoint(size_t a_index) const
+	typename PathType::TransitionPoint TimelineTrack<PathType>::GetPoint(size_t a_index) const
 	{
 		return m_path.GetPoint(a_index);
 	}
 
+	template <typename PathType>
+	void TimelineTrack<PathType>::GetPoints(std::vector<float>& a_times, std::vector<typename PathType::ValueType>& a_values) const
+	{
+		const size_t count = m_path.GetPointCount();
+		a_times.resize(count);
+		a_values.resize(count);
+		for (size_t i = 0; i < count; ++i) {
+			a_times[i] = m_path.GetPointTime(i);
+			a_values[i] = m_path.GetPointValue(i);
+		}
+	}
+
 	template <typename PathType>
 	bool TimelineTrack<PathType>::AddPathFromFile(const std::string& a_filePath, float a_timeOffset, float a_conversionFactor)
 	{
+		m_arcLengthValid = false;
 		return m_path.AddPathFromFile(a_filePath, a_timeOffset, a_conversionFactor);
 	}
 
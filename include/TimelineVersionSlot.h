@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "Timeline.h"
+
+namespace FCFW {
+    // Hands edited versions of a playing timeline to playback, RCU style. An editor copies the timeline, prepares the
+    // copy off the frame and publishes it; PlayTimeline takes it at the next frame boundary and continues at the
+    // current playback time. Versions are immutable once published. The version a frame replaces is parked here and
+    // freed by the next Publish(), so the frame never runs a Timeline destructor.
+    class TimelineVersionSlot {
+    public:
+        // Editor side. Versions are ordered by revision: an older version than the one waiting is dropped.
+        void Publish(std::shared_ptr<Timeline> a_version) {
+            m_retired.store(nullptr, std::memory_order_relaxed);
+            auto waiting = m_next.load(std::memory_order_acquire);
+            do {
+                if (waiting && waiting->GetRevision() >= a_version->GetRevision()) {
+                    return;
+                }
+            } while (!m_next.compare_exchange_weak(waiting, a_version, std::memory_order_acq_rel, std::memory_order_acquire));
+        }
+
+        // Frame side: the latest published version, if any. The caller still compares its revision with the
+        // version it plays, as a publish can race with a playback restart.
+        std::shared_ptr<Timeline> Take() {
+            return m_next.exchange(nullptr, std::memory_order_acq_rel);
+        }
+
+        void Retire(std::shared_ptr<Timeline> a_version) {
+            if (a_version) {
+                m_retired.store(std::move(a_version), std::memory_order_relaxed);
+            }
+        }
+
+        // Drops pending and retired versions (playback start/stop, not on the frame's hot path)
+        void Clear() {
+            m_next.store(nullptr, std::memory_order_relaxed);
+            m_retired.store(nullptr, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::shared_ptr<Timeline>> m_next;
+        std::atomic<std::shared_ptr<Timeline>> m_retired;
+    };
+} // namespace FCFW
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+
+namespace FCFW {
+    // Records spans and instant events as Chrome trace-event JSON (chrome://tracing, ui.perfetto.dev), to look at
+    // individual frames rather than the aggregates of FrameProfiler.
+    // Events go into a ring buffer allocated once on the first Arm(): a producer claims a slot with one atomic increment
+    // and publishes it with a sequence number, so recording never locks or allocates. Flush() copies the published events
+    // and writes the file on a worker thread. When the ring wraps between flushes, the oldest events are lost.
+    class TraceRecorder {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        static TraceRecorder& GetSingleton() {
+            static TraceRecorder instance;
+            return instance;
+        }
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        static bool IsArmed() {
+            return s_armed.load(std::memory_order_relaxed);
+        }
+
+        // Ring size in events, used when the first Arm() allocates the ring; no effect afterwards
+        void SetCapacity(std::size_t a_capacity);
+
+        // Starts recording. Flushes write a_filePath, then <stem>_2<ext>, <stem>_3<ext>, ...
+        bool Arm(const std::filesystem::path& a_filePath);
+
+        // Stops recording and flushes the remaining events
+        void Disarm();
+
+        // Writes the events recorded since the last flush. False if not armed or nothing was recorded.
+        bool Flush();
+
+        // Complete span, e.g. from a FrameProfiler::ScopedTimer. a_name must be a string literal (stored by pointer).
+        static void Span(const char* a_name, Clock::time_point a_start, Clock::time_point a_end, std::uint64_t a_timelineID = 0) {
+            if (IsArmed()) {
+                GetSingleton().Push(a_name, a_start, a_end - a_start, a_timelineID);
+            }
+        }
+
+        // Instant event (playback start, stop, ...). a_name must be a string literal.
+        static void Instant(const char* a_name, std::uint64_t a_timelineID = 0) {
+            if (IsArmed()) {
+                GetSingleton().Push(a_name, Clock::now(), Clock::duration(-1), a_timelineID);
+            }
+        }
+
+        // Span of the enclosing scope; no clock reads while not armed
+        class Scope {
+        public:
+            explicit Scope(const char* a_name, std::uint64_t a_timelineID = 0) : m_name(a_name), m_timelineID(a_timelineID), m_active(IsArmed()) {
+                if (m_active) {
+                    m_start = Clock::now();
+                }
+            }
+            ~Scope() {
+                if (m_active) {
+                    Span(m_name, m_start, Clock::now(), m_timelineID);
+                }
+            }
+            Scope(const Scope&) = delete;
+            Scope& operator=(const Scope&) = delete;
+
+        private:
+            const char* m_name;
+            std::uint64_t m_timelineID;
+            bool m_active;
+            Clock::time_point m_start;
+        };
+
+    private:
+        TraceRecorder() = default;
+
+        struct Event {
+            std::atomic<std::uint64_t> m_sequence{ 0 };  // Claimed index + 1 once published, 0 while being written
+            const char* m_name = nullptr;
+            std::int64_t m_start = 0;                     // Nanoseconds since Arm()
+            std::int64_t m_duration = 0;                  // Nanoseconds, < 0 for instant events
+            std::uint64_t m_timelineID = 0;
+            std::uint32_t m_thread = 0;
+        };
+
+        void Push(const char* a_name, Clock::time_point a_start, Clock::duration a_duration, std::uint64_t a_timelineID);
+        std::filesystem::path GetFlushPath() const;
+        static std::uint32_t GetThreadIndex();
+
+        static inline std::atomic<bool> s_armed{ false };
+
+        std::unique_ptr<Event[]> m_events;  // Never freed once allocated: producers may still be writing after Disarm()
+        std::size_t m_capacity = 1 << 17;  // About 6 MB, two minutes of playback at 60 fps
+        std::atomic<std::uint64_t> m_writeIndex{ 0 };
+        std::uint64_t m_flushedIndex = 0;
+        Clock::time_point m_origin{};
+        std::filesystem::path m_filePath;
+        std::uint32_t m_flushCount = 0;
+        std::mutex m_flushLock;  // Arm/Disarm/Flush only, never taken by producers
+    };
+} // namespace FCFW
@@ -17,6 +17,8 @@ namespace FCFW {
             static constexpr const char* SectionName = "translationPoints";
             static constexpr const char* ValueKey = "position";
             static constexpr size_t ValueSize = 3;
+            static constexpr const char* ChannelSectionName = "translationChannels";
+            static constexpr std::array<const char*, 3> AxisNames = { "x", "y", "z" };
             
             static ValueType ReadValue(const YAML::Node& node, float conversionFactor) {
                 return ValueType{
@@ -40,6 +42,8 @@ namespace FCFW {
             static constexpr const char* SectionName = "rotationPoints";
             static constexpr const char* ValueKey = "rotation";
             static constexpr size_t ValueSize = 3;
+            static constexpr const char* ChannelSectionName = "rotationChannels";
+            static constexpr std::array<const char*, 3> AxisNames = { "pitch", "roll", "yaw" };
             
             static ValueType ReadValue(const YAML::Node& node, float conversionFactor) {
                 return ValueType{
@@ -76,6 +80,43 @@ namespace FCFW {
         };
     }
     
+    // Template helper for importing a per-channel section: each axis is either a constant value or a key list
+    template<typename PointType, typename PathType>
+    void ImportChannelsFromYAML(PathType* path, const YAML::Node& a_section, float a_timeOffset, float a_conversionFactor) {
+        using Traits = PointTraits<PointType>;
+        
+        typename PathType::ChannelSet channels;
+        for (size_t axis = 0; axis < Traits::AxisNames.size(); ++axis) {
+            const YAML::Node axisNode = a_section[Traits::AxisNames[axis]];
+            if (!axisNode) {
+                continue;  // unlisted axes stay at 0
+            }
+            if (axisNode.IsScalar()) {
+                channels[axis].SetConstant(axisNode.as<float>() * a_conversionFactor);
+                continue;
+            }
+            
+            for (const auto& keyNode : axisNode) {
+                if (!keyNode["time"] || !keyNode["value"]) {
+                    log::warn("{}: Skipping '{}' key without 'time' or 'value' field", __FUNCTION__, Traits::AxisNames[axis]);
+                    continue;
+                }
+                
+                float time = keyNode["time"].as<float>() + a_timeOffset;
+                bool easeIn = keyNode["easeIn"] ? keyNode["easeIn"].as<bool>() : false;
+                bool easeOut = keyNode["easeOut"] ? keyNode["easeOut"].as<bool>() : false;
+                
+                InterpolationMode mode = InterpolationMode::kCubicHermite;
+                if (keyNode["interpolationMode"]) {
+                    mode = StringToInterpolationMode(keyNode["interpolationMode"].as<std::string>());
+                }
+                
+                channels[axis].AddKey({ Transition(time, mode, easeIn, easeOut), keyNode["value"].as<float>() * a_conversionFactor });
+            }
+        }
+        path->AddChannels(channels);
+    }
+
     // Template helper for importing points from YAML
     template<typename PointType, typename PathType>
     bool ImportPathFromYAML(PathType* path, const std::string& a_filePath, float a_timeOffset, float a_conversionFactor) {
@@ -96,12 +137,18 @@ namespace FCFW {
                 log::info("{}: No formatVersion specified, assuming version 1", __FUNCTION__);
             }
             
+            if (root[Traits::ChannelSectionName]) {
+                ImportChannelsFromYAML<PointType>(path, root[Traits::ChannelSectionName], a_timeOffset, a_conversionFactor);
+            }
+            
             if (!root[Traits::SectionName]) {
-                log::info("{}: No '{}' section in YAML file", __FUNCTION__, Traits::SectionName);
+                if (!root[Traits::ChannelSectionName]) {
+                    log::info("{}: No '{}' section in YAML file", __FUNCTION__, Traits::SectionName);
+                }
                 return true;
             }
             
-            for (const auto& pointNode : root[Traits::SectionName]) {
+            for (const YAML::Node& pointNode : root[Traits::SectionName]) {
                 if (!pointNode["time"]) {
                     log::warn("{}: Skipping point without 'time' field", __FUNCTION__);
                     continue;
@@ -218,6 +265,50 @@ namespace FCFW {
         }
     }
 
+    // Template helper for exporting a channelized path as a per-channel section
+    template<typename PointType, typename ChannelSet>
+    void ExportChannelsToYAML(const ChannelSet& a_channels, std::ofstream& a_file, float a_conversionFactor) {
+        using Traits = PointTraits<PointType>;
+        
+        YAML::Emitter out;
+        out << YAML::BeginMap;
+        out << YAML::Key << Traits::ChannelSectionName;
+        out << YAML::Value << YAML::BeginMap;
+        
+        for (size_t axis = 0; axis < Traits::AxisNames.size(); ++axis) {
+            const ScalarChannel& channel = a_channels[axis];
+            out << YAML::Key << Traits::AxisNames[axis] << YAML::Value;
+            if (!channel.IsKeyed()) {
+                out << channel.GetConstant() * a_conversionFactor;
+                continue;
+            }
+            
+            out << YAML::BeginSeq;
+            for (const auto& key : channel.GetKeys()) {
+                out << YAML::BeginMap;
+                out << YAML::Key << "time" << YAML::Value << key.m_transition.m_time;
+                out << YAML::Key << "value" << YAML::Value << key.m_value * a_conversionFactor;
+                out << YAML::Key << "interpolationMode" << YAML::Value << InterpolationModeToString(key.m_transition.m_mode);
+                out << YAML::Key << "easeIn" << YAML::Value << (key.m_transition.m_easeIn ? true : false);
+                out << YAML::Key << "easeOut" << YAML::Value << (key.m_transition.m_easeOut ? true : false);
+                out << YAML::EndMap;
+            }
+            out << YAML::EndSeq;
+        }
+        
+        out << YAML::EndMap;
+        out << YAML::EndMap;
+        
+        // Extract section and write to stream
+        std::string yamlStr = out.c_str();
+        size_t startPos = yamlStr.find(Traits::ChannelSectionName);
+        if (startPos != std::string::npos) {
+            a_file << yamlStr.substr(startPos);
+        } else {
+            a_file << yamlStr;
+        }
+    }
+
     // Template helper for exporting points to YAML
     template<typename PointType, typename PathType>
     bool ExportPathToYAML(const PathType* path, std::ofstream& a_file, float a_conversionFactor) {
@@ -229,12 +320,18 @@ namespace FCFW {
         }
 
         try {
+            if (const auto* channels = path->GetChannels()) {
+                ExportChannelsToYAML<PointType>(*channels, a_file, a_conversionFactor);
+                return true;
+            }
+            
             YAML::Emitter out;
             out << YAML::BeginMap;
             out << YAML::Key << Traits::SectionName;
             out << YAML::Value << YAML::BeginSeq;
             
-            for (const auto& point : path->m_points) {
+            for (size_t i = 0; i < path->GetPointCount(); ++i) {
+                const PointType point = path->BuildPoint(i);
                 out << YAML::BeginMap;
                 out << YAML::Key << "time" << YAML::Value << point.m_transition.m_time;
                 out << YAML::Key << "type" << YAML::Value << PointTypeToString(point.m_pointType);
@@ -302,6 +399,122 @@ namespace FCFW {
         }
     }
     
+    // ===== ScalarChannel implementations =====
+
+    void ScalarChannel::AddKey(const Key& a_key) {
+        Key key = a_key;
+        key.m_transition.m_time = std::max(key.m_transition.m_time, 0.0f);
+        auto it = std::lower_bound(m_keys.begin(), m_keys.end(), key.m_transition.m_time,
+            [](const Key& other, float time) {
+                return other.m_transition.m_time < time;
+            });
+        m_keys.insert(it, key);
+        m_cursor = 0;
+    }
+
+    size_t ScalarChannel::FindKey(float a_time) const {
+        // First key with time >= a_time, checking the cursor and its successor before searching (see TimelineTrack::FindSegment)
+        const size_t keyCount = m_keys.size();
+        auto containsTime = [&](size_t a_index) {
+            if (a_index > keyCount) {
+                return false;
+            }
+            bool afterPrev = a_index == 0 || m_keys[a_index - 1].m_transition.m_time < a_time;
+            bool notAfterCurrent = a_index == keyCount || a_time <= m_keys[a_index].m_transition.m_time;
+            return afterPrev && notAfterCurrent;
+        };
+
+        if (containsTime(m_cursor)) {
+            return m_cursor;
+        }
+        if (containsTime(m_cursor + 1)) {
+            return ++m_cursor;
+        }
+
+        FrameProfiler::Count(FrameCounter::kSegmentSearches);
+        auto it = std::lower_bound(m_keys.begin(), m_keys.end(), a_time,
+            [](const Key& key, float time) {
+                return key.m_transition.m_time < time;
+            });
+        m_cursor = static_cast<size_t>(std::distance(m_keys.begin(), it));
+        return m_cursor;
+    }
+
+    float ScalarChannel::Evaluate(float a_time, bool a_loop, float a_loopEnd) const {
+        auto output = [this](float a_value) {
+            return m_isAngle ? _ts_SKSEFunctions::NormalRelativeAngle(a_value) : a_value;
+        };
+
+        const size_t keyCount = m_keys.size();
+        if (keyCount == 0) {
+            return output(m_constant);
+        }
+
+        // Same segment lookup as TimelineTrack::GetSegmentAtTime; index keyCount is the virtual loop segment
+        const float lastTime = m_keys.back().m_transition.m_time;
+        size_t index;
+        float progress = 1.0f;
+        if (a_loop && a_loopEnd > lastTime && a_time > lastTime) {
+            index = keyCount;
+            progress = std::clamp((a_time - lastTime) / (a_loopEnd - lastTime), 0.0f, 1.0f);
+        } else {
+            index = FindKey(a_time);
+            if (index >= keyCount) {
+                return output(m_keys.back().m_value);
+            }
+            if (index == 0) {
+                return output(m_keys.front().m_value);
+            }
+            const float prevTime = m_keys[index - 1].m_transition.m_time;
+            const float duration = m_keys[index].m_transition.m_time - prevTime;
+            if (duration > 0.0f) {
+                progress = std::clamp((a_time - prevTime) / duration, 0.0f, 1.0f);
+            }
+        }
+        if (keyCount == 1) {
+            return output(m_keys.front().m_value);
+        }
+
+        const InterpolationMode mode = m_keys[std::min(index, keyCount - 1)].m_transition.m_mode;
+        if (mode == InterpolationMode::kNone) {
+            return output(m_keys[std::min(index, keyCount - 1)].m_value);
+        }
+
+        // Angles: move each control value to within half a turn of its neighbour before interpolating
+        auto unwrap = [this](float a_value, float a_reference) {
+            return m_isAngle ? a_reference + _ts_SKSEFunctions::NormalRelativeAngle(a_value - a_reference) : a_value;
+        };
+
+        const size_t current = index % keyCount;
+        const size_t prev = (current + keyCount - 1) % keyCount;
+        const Transition& easeKey = m_keys[current].m_transition;
+        const float t = _ts_SKSEFunctions::ApplyEasing(progress, easeKey.m_easeIn, easeKey.m_easeOut);
+        const float prevValue = m_keys[prev].m_value;
+        const float currentValue = unwrap(m_keys[current].m_value, prevValue);
+
+        const bool isCubic = mode == InterpolationMode::kCubicHermite;
+        if (std::abs(currentValue - prevValue) < EPSILON_COMPARISON) {
+            return output(isCubic ? prevValue : currentValue);
+        }
+        if (!isCubic) {
+            return output(prevValue + t * (currentValue - prevValue));
+        }
+
+        // Neighbours as in CameraPath::GetHermiteControlIndices
+        size_t before;
+        size_t after;
+        if (a_loop) {
+            before = (current + keyCount - 2) % keyCount;
+            after = (current + 1) % keyCount;
+        } else {
+            before = current >= 2 ? current - 2 : current - 1;
+            after = current + 1 < keyCount ? current + 1 : current;
+        }
+        const float beforeValue = unwrap(m_keys[before].m_value, prevValue);
+        const float afterValue = unwrap(m_keys[after].m_value, currentValue);
+        return output(CubicHermiteInterpolate(beforeValue, prevValue, currentValue, afterValue, t));
+    }
+
     // ===== TranslationPath implementations =====
 
     TranslationPoint TranslationPath::GetPointAtCamera(float a_time, bool a_easeIn, bool a_easeOut) const {
@@ -417,7 +630,8 @@ namespace FCFW {
             out << YAML::Key << "fovPoints";
             out << YAML::Value << YAML::BeginSeq;
             
-            for (const auto& point : m_points) {
+            for (size_t i = 0; i < GetPointCount(); ++i) {
+                const FOVPoint point = BuildPoint(i);
                 out << YAML::BeginMap;
                 out << YAML::Key << "time" << YAML::Value << point.m_transition.m_time;
                 out << YAML::Key << "fov" << YAML::Value << point.m_point;
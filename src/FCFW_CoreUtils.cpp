@@ -0,0 +1,252 @@
+#include "FCFW_Utils.h"
+
+#if defined(__AVX2__) || defined(_M_X64) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// FCFW_Utils helpers without game dependencies: YAML enum conversion and interpolation math.
+// Also compiled into the headless core library (see headless/CMakeLists.txt).
+
+namespace FCFW {
+    // ===== YAML Enum Conversion Helpers =====
+    
+    // Convert string to PointType enum
+    PointType StringToPointType(const std::string& str) {
+        if (str == "world") return PointType::kWorld;
+        if (str == "reference") return PointType::kReference;
+        if (str == "camera") return PointType::kCamera;
+        log::warn("Unknown PointType '{}', defaulting to 'world'", str);
+        return PointType::kWorld;
+    }
+    
+    // Convert PointType enum to string
+    std::string PointTypeToString(PointType type) {
+        switch (type) {
+            case PointType::kWorld: return "world";
+            case PointType::kReference: return "reference";
+            case PointType::kCamera: return "camera";
+            default: return "world";
+        }
+    }
+    
+    // Convert string to InterpolationMode enum
+    InterpolationMode StringToInterpolationMode(const std::string& str) {
+        if (str == "none") return InterpolationMode::kNone;
+        if (str == "linear") return InterpolationMode::kLinear;
+        if (str == "cubicHermite" || str == "cubic") return InterpolationMode::kCubicHermite;
+        log::warn("Unknown InterpolationMode '{}', defaulting to 'cubicHermite'", str);
+        return InterpolationMode::kCubicHermite;
+    }
+    
+    // Convert InterpolationMode enum to string
+    std::string InterpolationModeToString(InterpolationMode mode) {
+        switch (mode) {
+            case InterpolationMode::kNone: return "none";
+            case InterpolationMode::kLinear: return "linear";
+            case InterpolationMode::kCubicHermite: return "cubicHermite";
+            default: return "cubicHermite";
+        }
+    }
+    
+    // Convert string to PlaybackMode enum
+    PlaybackMode StringToPlaybackMode(const std::string& str) {
+        if (str == "end") return PlaybackMode::kEnd;
+        if (str == "loop") return PlaybackMode::kLoop;
+        if (str == "wait") return PlaybackMode::kWait;
+        log::warn("Unknown PlaybackMode '{}', defaulting to 'end'", str);
+        return PlaybackMode::kEnd;
+    }
+    
+    // Convert PlaybackMode enum to string
+    std::string PlaybackModeToString(PlaybackMode mode) {
+        switch (mode) {
+            case PlaybackMode::kEnd: return "end";
+            case PlaybackMode::kLoop: return "loop";
+            case PlaybackMode::kWait: return "wait";
+            default: return "end";
+        }
+    }
+    
+    // Convert string to BodyPart enum
+    BodyPart StringToBodyPart(const std::string& str) {
+        if (str == "none") return BodyPart::kNone;
+        if (str == "head") return BodyPart::kHead;
+        if (str == "torso") return BodyPart::kTorso;
+        log::warn("Unknown BodyPart '{}', defaulting to 'none'", str);
+        return BodyPart::kNone;
+    }
+    
+    // Convert BodyPart enum to string
+    std::string BodyPartToString(BodyPart part) {
+        switch (part) {
+            case BodyPart::kNone: return "none";
+            case BodyPart::kHead: return "head";
+            case BodyPart::kTorso: return "torso";
+            default: return "none";
+        }
+    }
+
+    void ComputeHermiteBasis(float t, float& h00, float& h10, float& h01, float& h11) {
+        float t2 = t * t;
+        float t3 = t2 * t;
+        
+        h00 = 2.0f * t3 - 3.0f * t2 + 1.0f;   // basis for p1
+        h10 = t3 - 2.0f * t2 + t;              // basis for m1
+        h01 = -2.0f * t3 + 3.0f * t2;          // basis for p2
+        h11 = t3 - t2;                          // basis for m2
+    }
+
+    float CubicHermiteInterpolate(float a0, float a1, float a2, float a3, float t) {
+        // Compute Catmull-Rom tangents
+        float m1 = (a2 - a0) * 0.5f;
+        float m2 = (a3 - a1) * 0.5f;
+
+        float h00, h10, h01, h11;
+        ComputeHermiteBasis(t, h00, h10, h01, h11);
+
+        return a1 * h00 + m1 * h10 + a2 * h01 + m2 * h11;
+    };
+
+    CubicCoefficients ComputeCubicHermiteCoefficients(float a0, float a1, float a2, float a3) {
+        // Same Catmull-Rom tangents as CubicHermiteInterpolate
+        float m1 = (a2 - a0) * 0.5f;
+        float m2 = (a3 - a1) * 0.5f;
+
+        // Expand a1*h00 + m1*h10 + a2*h01 + m2*h11 into powers of t
+        CubicCoefficients result;
+        result.a = 2.0f * a1 + m1 - 2.0f * a2 + m2;
+        result.b = -3.0f * a1 - 2.0f * m1 + 3.0f * a2 - m2;
+        result.c = m1;
+        result.d = a1;
+        return result;
+    }
+
+    void EvaluateCubicBatch(const CubicCoefficients& a_coefficients, std::span<const float> a_t, std::span<float> a_out) {
+        const size_t count = std::min(a_t.size(), a_out.size());
+        size_t i = 0;
+
+        // Same Horner order as CubicCoefficients::Evaluate (mul + add, no FMA) so batch and scalar results match
+#if defined(__AVX2__)
+        const __m256 a8 = _mm256_set1_ps(a_coefficients.a);
+        const __m256 b8 = _mm256_set1_ps(a_coefficients.b);
+        const __m256 c8 = _mm256_set1_ps(a_coefficients.c);
+        const __m256 d8 = _mm256_set1_ps(a_coefficients.d);
+        for (; i + 8 <= count; i += 8) {
+            const __m256 t = _mm256_loadu_ps(a_t.data() + i);
+            __m256 r = _mm256_add_ps(_mm256_mul_ps(a8, t), b8);
+            r = _mm256_add_ps(_mm256_mul_ps(r, t), c8);
+            r = _mm256_add_ps(_mm256_mul_ps(r, t), d8);
+            _mm256_storeu_ps(a_out.data() + i, r);
+        }
+#endif
+#if defined(__AVX2__) || defined(_M_X64) || defined(__SSE2__)
+        const __m128 a4 = _mm_set1_ps(a_coefficients.a);
+        const __m128 b4 = _mm_set1_ps(a_coefficients.b);
+        const __m128 c4 = _mm_set1_ps(a_coefficients.c);
+        const __m128 d4 = _mm_set1_ps(a_coefficients.d);
+        for (; i + 4 <= count; i += 4) {
+            const __m128 t = _mm_loadu_ps(a_t.data() + i);
+            __m128 r = _mm_add_ps(_mm_mul_ps(a4, t), b4);
+            r = _mm_add_ps(_mm_mul_ps(r, t), c4);
+            r = _mm_add_ps(_mm_mul_ps(r, t), d4);
+            _mm_storeu_ps(a_out.data() + i, r);
+        }
+#endif
+        for (; i < count; ++i) {
+            a_out[i] = a_coefficients.Evaluate(a_t[i]);
+        }
+    }
+
+    void EvaluateCubicLanes(const CubicLanes& a_lanes, float t, float* a_out) {
+        // Same Horner order as CubicCoefficients::Evaluate (mul + add, no FMA)
+#if defined(__AVX2__)
+        const __m256 t8 = _mm256_set1_ps(t);
+        __m256 r = _mm256_add_ps(_mm256_mul_ps(_mm256_load_ps(a_lanes.a), t8), _mm256_load_ps(a_lanes.b));
+        r = _mm256_add_ps(_mm256_mul_ps(r, t8), _mm256_load_ps(a_lanes.c));
+        r = _mm256_add_ps(_mm256_mul_ps(r, t8), _mm256_load_ps(a_lanes.d));
+        _mm256_storeu_ps(a_out, r);
+#elif defined(_M_X64) || defined(__SSE2__)
+        const __m128 t4 = _mm_set1_ps(t);
+        for (size_t i = 0; i < CubicLanes::kLaneCount; i += 4) {
+            __m128 r = _mm_add_ps(_mm_mul_ps(_mm_load_ps(a_lanes.a + i), t4), _mm_load_ps(a_lanes.b + i));
+            r = _mm_add_ps(_mm_mul_ps(r, t4), _mm_load_ps(a_lanes.c + i));
+            r = _mm_add_ps(_mm_mul_ps(r, t4), _mm_load_ps(a_lanes.d + i));
+            _mm_storeu_ps(a_out + i, r);
+        }
+#else
+        for (size_t i = 0; i < CubicLanes::kLaneCount; ++i) {
+            a_out[i] = ((a_lanes.a[i] * t + a_lanes.b[i]) * t + a_lanes.c[i]) * t + a_lanes.d[i];
+        }
+#endif
+    }
+
+    Quaternion EulerToQuaternion(const RE::NiPoint3& a_euler) {
+        // q = qYaw(z) * qPitch(x) * qRoll(y)
+        const float cp = std::cos(a_euler.x * 0.5f), sp = std::sin(a_euler.x * 0.5f);
+        const float cr = std::cos(a_euler.y * 0.5f), sr = std::sin(a_euler.y * 0.5f);
+        const float cy = std::cos(a_euler.z * 0.5f), sy = std::sin(a_euler.z * 0.5f);
+
+        Quaternion result;
+        result.w = cy * cp * cr - sy * sp * sr;
+        result.x = cy * sp * cr - sy * cp * sr;
+        result.y = cy * cp * sr + sy * sp * cr;
+        result.z = sy * cp * cr + cy * sp * sr;
+        return result;
+    }
+
+    RE::NiPoint3 QuaternionToEuler(const Quaternion& a_quat) {
+        // Rotation matrix terms of Rz(yaw) * Rx(pitch) * Ry(roll), written in homogeneous form
+        // (every term scaled by |q|^2) so interpolated, non-unit quaternions need no normalization
+        const float w = a_quat.w, x = a_quat.x, y = a_quat.y, z = a_quat.z;
+        const float ww = w * w, xx = x * x, yy = y * y, zz = z * z;
+        const float lengthSquared = ww + xx + yy + zz;
+        if (lengthSquared < EPSILON_COMPARISON * EPSILON_COMPARISON) {
+            return RE::NiPoint3{ 0.0f, 0.0f, 0.0f };
+        }
+
+        const float sinPitch = std::clamp(2.0f * (y * z + w * x) / lengthSquared, -1.0f, 1.0f);
+        return RE::NiPoint3{
+            std::asin(sinPitch),                                  // pitch
+            std::atan2(2.0f * (w * y - x * z), ww - xx - yy + zz),  // roll
+            std::atan2(2.0f * (w * z - x * y), ww - xx + yy - zz)}; // yaw
+    }
+
+    std::array<CubicCoefficients, 4> ComputeQuaternionSlerpCoefficients(const Quaternion& q1, const Quaternion& q2) {
+        // q and -q are the same rotation: take the short way around
+        const Quaternion to = q1.Dot(q2) < 0.0f ? -q2 : q2;
+        const float cosTheta = std::clamp(q1.Dot(to), -1.0f, 1.0f);
+
+        // Normalized lerp q1 + (q2 - q1) * u follows the slerp arc; u(t) = t + k * t * (t - 0.5) * (t - 1)
+        // corrects its speed. k matches slerp exactly at t = 0.25 (and by symmetry at 0, 0.5, 0.75, 1).
+        float k = 0.0f;
+        if (cosTheta < 1.0f - EPSILON_COMPARISON) {
+            const float theta = std::acos(cosTheta);
+            const float s1 = std::sin(0.25f * theta);
+            const float s3 = std::sin(0.75f * theta);
+            const float u = s1 / (s1 + s3);
+            k = (u - 0.25f) / 0.046875f;  // 0.25 * (0.25 - 0.5) * (0.25 - 1)
+        }
+
+        // u(t) = k*t^3 - 1.5k*t^2 + (1 + 0.5k)*t
+        auto channel = [k](float a_from, float a_to) {
+            const float delta = a_to - a_from;
+            return CubicCoefficients{ delta * k, delta * -1.5f * k, delta * (1.0f + 0.5f * k), a_from };
+        };
+        return { channel(q1.w, to.w), channel(q1.x, to.x), channel(q1.y, to.y), channel(q1.z, to.z) };
+    }
+
+    std::array<CubicCoefficients, 4> ComputeQuaternionHermiteCoefficients(const Quaternion& q0, const Quaternion& q1,
+                                                                          const Quaternion& q2, const Quaternion& q3) {
+        // Flip neighbours into the hemisphere of their predecessor so every step is the short arc
+        const Quaternion a1 = q1;
+        const Quaternion a0 = a1.Dot(q0) < 0.0f ? -q0 : q0;
+        const Quaternion a2 = a1.Dot(q2) < 0.0f ? -q2 : q2;
+        const Quaternion a3 = a2.Dot(q3) < 0.0f ? -q3 : q3;
+
+        return {
+            ComputeCubicHermiteCoefficients(a0.w, a1.w, a2.w, a3.w),
+            ComputeCubicHermiteCoefficients(a0.x, a1.x, a2.x, a3.x),
+            ComputeCubicHermiteCoefficients(a0.y, a1.y, a2.y, a3.y),
+            ComputeCubicHermiteCoefficients(a0.z, a1.z, a2.z, a3.z)};
+    }
+} // namespace FCFW
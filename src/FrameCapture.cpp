@@ -0,0 +1,312 @@
+#include "FrameCapture.h"
+#include "CLIBUtil/EditorID.hpp"
+
+namespace FCFW {
+    namespace {
+        // File: magic, version, session header, then tagged records until the end tag. Little-endian, 32-bit floats.
+        constexpr char kMagic[8] = { 'F', 'C', 'F', 'W', 'C', 'A', 'P', '\0' };
+        constexpr std::uint32_t kVersion = 1;
+
+        enum class RecordTag : std::uint8_t {
+            kForm = 'F',
+            kFrameBegin = 'B',
+            kReference = 'R',
+            kLandHeight = 'L',
+            kFrameEnd = 'E',
+            kSessionEnd = 'X'
+        };
+
+        enum ReferenceFlags : std::uint8_t {
+            kOffsetRelative = 1 << 0,
+            kLoaded = 1 << 1,
+            kBodyFrame = 1 << 2
+        };
+
+        template <typename T>
+        void Write(std::ofstream& a_file, const T& a_value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            a_file.write(reinterpret_cast<const char*>(&a_value), sizeof(T));
+        }
+
+        void WritePoint(std::ofstream& a_file, const RE::NiPoint3& a_point) {
+            Write(a_file, a_point.x);
+            Write(a_file, a_point.y);
+            Write(a_file, a_point.z);
+        }
+
+        void WriteString(std::ofstream& a_file, std::string_view a_string) {
+            const auto length = static_cast<std::uint16_t>(std::min<size_t>(a_string.size(), UINT16_MAX));
+            Write(a_file, length);
+            a_file.write(a_string.data(), length);
+        }
+
+        template <typename T>
+        bool Read(std::ifstream& a_file, T& a_value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            return static_cast<bool>(a_file.read(reinterpret_cast<char*>(&a_value), sizeof(T)));
+        }
+
+        bool ReadPoint(std::ifstream& a_file, RE::NiPoint3& a_point) {
+            return Read(a_file, a_point.x) && Read(a_file, a_point.y) && Read(a_file, a_point.z);
+        }
+
+        bool ReadString(std::ifstream& a_file, std::string& a_string) {
+            std::uint16_t length = 0;
+            if (!Read(a_file, length)) {
+                return false;
+            }
+            a_string.resize(length);
+            return static_cast<bool>(a_file.read(a_string.data(), length));
+        }
+
+        bool ReadBool(std::ifstream& a_file, bool& a_value) {
+            std::uint8_t value = 0;
+            if (!Read(a_file, value)) {
+                return false;
+            }
+            a_value = value != 0;
+            return true;
+        }
+    }
+
+    bool FrameCapture::Arm(const std::filesystem::path& a_filePath) {
+        Disarm();
+        m_file.open(a_filePath, std::ios::binary | std::ios::trunc);
+        if (!m_file.is_open()) {
+            log::error("{}: Failed to open capture file {}", __FUNCTION__, a_filePath.string());
+            return false;
+        }
+        m_filePath = a_filePath;
+        log::info("{}: Capturing the next playback to {}", __FUNCTION__, a_filePath.string());
+        return true;
+    }
+
+    void FrameCapture::Disarm() {
+        if (m_inSession) {
+            EndSession();
+        }
+        if (m_file.is_open()) {
+            m_file.close();
+        }
+    }
+
+    void FrameCapture::BeginSession(const CapturedSession& a_session) {
+        if (!m_file.is_open() || m_inSession) {
+            return;
+        }
+        m_inSession = true;
+        m_inFrame = false;
+        m_frameCount = 0;
+        m_writtenForms.clear();
+
+        m_file.write(kMagic, sizeof(kMagic));
+        Write(m_file, kVersion);
+        Write(m_file, a_session.m_settings.m_speed);
+        Write(m_file, static_cast<std::uint8_t>(a_session.m_settings.m_constantSpeed));
+        Write(m_file, static_cast<std::uint8_t>(a_session.m_settings.m_followGround));
+        Write(m_file, a_session.m_settings.m_minHeightAboveGround);
+        Write(m_file, static_cast<std::uint8_t>(a_session.m_globalEaseIn));
+        Write(m_file, static_cast<std::uint8_t>(a_session.m_globalEaseOut));
+        Write(m_file, a_session.m_startTime);
+        WritePoint(m_file, a_session.m_cameraPosition);
+        WritePoint(m_file, a_session.m_cameraRotation);
+        Write(m_file, a_session.m_cameraFOV);
+    }
+
+    void FrameCapture::EndSession() {
+        if (!m_inSession) {
+            return;
+        }
+        Write(m_file, RecordTag::kSessionEnd);
+        m_inSession = false;
+        m_inFrame = false;
+        m_file.close();
+        log::info("{}: Captured {} frames to {}", __FUNCTION__, m_frameCount, m_filePath.string());
+    }
+
+    void FrameCapture::BeginFrame(float a_realDeltaTime) {
+        if (!m_inSession) {
+            return;
+        }
+        m_inFrame = true;
+        Write(m_file, RecordTag::kFrameBegin);
+        Write(m_file, a_realDeltaTime);
+    }
+
+    void FrameCapture::RecordReference(RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative, const ResolvedReference& a_resolved) {
+        if (!m_inFrame || !a_reference) {
+            return;
+        }
+
+        const RE::FormID formID = a_reference->GetFormID();
+        if (std::find(m_writtenForms.begin(), m_writtenForms.end(), formID) == m_writtenForms.end()) {
+            m_writtenForms.push_back(formID);
+            auto* file = a_reference->GetFile(0);
+            Write(m_file, RecordTag::kForm);
+            Write(m_file, formID);
+            Write(m_file, static_cast<std::uint8_t>(a_reference->As<RE::Actor>() != nullptr));
+            WriteString(m_file, clib_util::editorID::get_editorID(a_reference));
+            WriteString(m_file, file ? std::string_view(file->fileName) : std::string_view());
+        }
+
+        std::uint8_t flags = 0;
+        flags |= a_isOffsetRelative ? kOffsetRelative : 0;
+        flags |= a_resolved.m_isLoaded ? kLoaded : 0;
+        flags |= a_resolved.m_hasBodyFrame ? kBodyFrame : 0;
+        Write(m_file, RecordTag::kReference);
+        Write(m_file, formID);
+        Write(m_file, static_cast<std::uint8_t>(a_bodyPart));
+        Write(m_file, flags);
+        if (a_resolved.m_isLoaded) {
+            WritePoint(m_file, a_resolved.m_position);
+            WritePoint(m_file, a_resolved.m_rotation);
+        }
+        if (a_resolved.m_hasBodyFrame) {
+            WritePoint(m_file, a_resolved.m_forward);
+            WritePoint(m_file, a_resolved.m_right);
+            WritePoint(m_file, a_resolved.m_up);
+        }
+    }
+
+    void FrameCapture::RecordLandHeight(const RE::NiPoint3& a_position, float a_height) {
+        if (!m_inFrame) {
+            return;
+        }
+        Write(m_file, RecordTag::kLandHeight);
+        WritePoint(m_file, a_position);
+        Write(m_file, a_height);
+    }
+
+    void FrameCapture::EndFrame(const PlaybackFrame& a_output) {
+        if (!m_inFrame) {
+            return;
+        }
+        m_inFrame = false;
+        ++m_frameCount;
+        Write(m_file, RecordTag::kFrameEnd);
+        WritePoint(m_file, a_output.m_position);
+        WritePoint(m_file, a_output.m_rotation);
+        Write(m_file, a_output.m_fov);
+        Write(m_file, static_cast<std::uint8_t>(a_output.m_hasFOV));
+    }
+
+    bool FrameCapture::ReadFile(const std::filesystem::path& a_filePath, CapturedSession& a_session) {
+        std::ifstream file(a_filePath, std::ios::binary);
+        if (!file.is_open()) {
+            log::error("{}: Failed to open capture file {}", __FUNCTION__, a_filePath.string());
+            return false;
+        }
+
+        char magic[sizeof(kMagic)] = {};
+        std::uint32_t version = 0;
+        if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || !Read(file, version)) {
+            log::error("{}: {} is not a frame capture", __FUNCTION__, a_filePath.string());
+            return false;
+        }
+        if (version != kVersion) {
+            log::error("{}: Unsupported capture version {} in {}", __FUNCTION__, version, a_filePath.string());
+            return false;
+        }
+
+        a_session = CapturedSession{};
+        if (!Read(file, a_session.m_settings.m_speed) || !ReadBool(file, a_session.m_settings.m_constantSpeed) ||
+            !ReadBool(file, a_session.m_settings.m_followGround) || !Read(file, a_session.m_settings.m_minHeightAboveGround) ||
+            !ReadBool(file, a_session.m_globalEaseIn) || !ReadBool(file, a_session.m_globalEaseOut) || !Read(file, a_session.m_startTime) ||
+            !ReadPoint(file, a_session.m_cameraPosition) || !ReadPoint(file, a_session.m_cameraRotation) || !Read(file, a_session.m_cameraFOV)) {
+            log::error("{}: Truncated session header in {}", __FUNCTION__, a_filePath.string());
+            return false;
+        }
+
+        // A capture cut short (game closed during playback) keeps its complete frames
+        CapturedFrame frame;
+        bool inFrame = false;
+        RecordTag tag;
+        while (Read(file, tag)) {
+            bool complete = true;
+            switch (tag) {
+                case RecordTag::kForm: {
+                    CapturedForm form;
+                    complete = Read(file, form.m_formID) && ReadBool(file, form.m_isActor) && ReadString(file, form.m_editorID) && ReadString(file, form.m_plugin);
+                    a_session.m_forms.push_back(std::move(form));
+                    break;
+                }
+                case RecordTag::kFrameBegin:
+                    frame = CapturedFrame{};
+                    inFrame = Read(file, frame.m_realDeltaTime);
+                    complete = inFrame;
+                    break;
+                case RecordTag::kReference: {
+                    CapturedReference reference;
+                    std::uint8_t bodyPart = 0;
+                    std::uint8_t flags = 0;
+                    complete = Read(file, reference.m_formID) && Read(file, bodyPart) && Read(file, flags);
+                    reference.m_bodyPart = static_cast<BodyPart>(bodyPart);
+                    reference.m_isOffsetRelative = (flags & kOffsetRelative) != 0;
+                    reference.m_resolved.m_isLoaded = (flags & kLoaded) != 0;
+                    reference.m_resolved.m_hasBodyFrame = (flags & kBodyFrame) != 0;
+                    if (complete && reference.m_resolved.m_isLoaded) {
+                        complete = ReadPoint(file, reference.m_resolved.m_position) && ReadPoint(file, reference.m_resolved.m_rotation);
+                    }
+                    if (complete && reference.m_resolved.m_hasBodyFrame) {
+                        complete = ReadPoint(file, reference.m_resolved.m_forward) && ReadPoint(file, reference.m_resolved.m_right) &&
+                                   ReadPoint(file, reference.m_resolved.m_up);
+                    }
+                    frame.m_references.push_back(reference);
+                    break;
+                }
+                case RecordTag::kLandHeight: {
+                    CapturedLandHeight landHeight;
+                    complete = ReadPoint(file, landHeight.m_position) && Read(file, landHeight.m_height);
+                    frame.m_landHeights.push_back(landHeight);
+                    break;
+                }
+                case RecordTag::kFrameEnd:
+                    complete = inFrame && ReadPoint(file, frame.m_output.m_position) && ReadPoint(file, frame.m_output.m_rotation) &&
+                               Read(file, frame.m_output.m_fov) && ReadBool(file, frame.m_output.m_hasFOV);
+                    if (complete) {
+                        a_session.m_frames.push_back(std::move(frame));
+                    }
+                    inFrame = false;
+                    break;
+                case RecordTag::kSessionEnd:
+                    return true;
+                default:
+                    log::error("{}: Unknown record 0x{:X} in {}", __FUNCTION__, static_cast<std::uint8_t>(tag), a_filePath.string());
+                    return !a_session.m_frames.empty();
+            }
+            if (!complete) {
+                break;
+            }
+        }
+
+        log::warn("{}: Capture {} ends without a session end record, keeping {} complete frames", __FUNCTION__, a_filePath.string(), a_session.m_frames.size());
+        return !a_session.m_frames.empty();
+    }
+
+    void FrameReplay::SetFrame(const CapturedFrame* a_frame) {
+        m_frame = a_frame;
+        m_nextLandHeight = 0;
+    }
+
+    ResolvedReference FrameReplay::ResolveReference(const RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative) const {
+        if (!m_frame || !a_reference) {
+            return ResolvedReference{};
+        }
+        const RE::FormID formID = a_reference->GetFormID();
+        for (const auto& captured : m_frame->m_references) {
+            if (captured.m_formID == formID && captured.m_bodyPart == a_bodyPart && captured.m_isOffsetRelative == a_isOffsetRelative) {
+                return captured.m_resolved;
+            }
+        }
+        return ResolvedReference{};
+    }
+
+    float FrameReplay::GetLandHeight(const RE::NiPoint3& a_position) {
+        if (!m_frame || m_frame->m_landHeights.empty()) {
+            return a_position.z;
+        }
+        const size_t index = std::min(m_nextLandHeight, m_frame->m_landHeights.size() - 1);
+        ++m_nextLandHeight;
+        return m_frame->m_landHeights[index].m_height;
+    }
+} // namespace FCFW
@@ -0,0 +1,218 @@
+#include "FrameProfiler.h"
+
+#include <bit>
+
+namespace FCFW {
+
+    void FrameProfiler::Configure(bool a_enabled, float a_windowSeconds, float a_logIntervalSeconds, bool a_logOnStop) {
+        const float windowSeconds = std::max(a_windowSeconds, 1.0f);
+        m_slotDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(windowSeconds / static_cast<float>(kSlotCount - 1)));
+        m_logInterval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(std::max(a_logIntervalSeconds, 0.0f)));
+        for (auto& slot : m_slots) {
+            ClearSlot(slot);
+        }
+        m_slotEnd = Clock::now() + m_slotDuration;
+        m_nextLog = Clock::now() + m_logInterval;
+        m_logOnStop = a_logOnStop;
+        s_enabled.store(a_enabled, std::memory_order_relaxed);
+        if (a_enabled) {
+            log::info("{}: Frame profiler enabled, {:.0f} s window, log interval {:.0f} s", __FUNCTION__, windowSeconds, std::max(a_logIntervalSeconds, 0.0f));
+        }
+    }
+
+    void FrameProfiler::BeginFrame() {
+        if (!IsEnabled()) {
+            return;
+        }
+
+        const auto now = Clock::now();
+        if (now >= m_slotEnd) {
+            // Drop the oldest slot (all of them after a long pause, e.g. in a menu)
+            const auto elapsedSlots = static_cast<std::size_t>((now - m_slotEnd) / m_slotDuration) + 1;
+            std::size_t slot = m_currentSlot.load(std::memory_order_relaxed);
+            for (std::size_t i = 0; i < std::min(elapsedSlots, kSlotCount); ++i) {
+                slot = (slot + 1) % kSlotCount;
+                ClearSlot(m_slots[slot]);
+            }
+            m_currentSlot.store(slot, std::memory_order_relaxed);
+            m_slotEnd = now + m_slotDuration;
+        }
+
+        if (m_logInterval > Clock::duration::zero() && now >= m_nextLog) {
+            m_nextLog = now + m_logInterval;
+            LogSummary();
+        }
+
+        AddCount(FrameCounter::kFrames, 1);
+    }
+
+    void FrameProfiler::Record(FrameStage a_stage, Clock::duration a_duration) {
+        const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(a_duration).count()));
+        Histogram& histogram = m_slots[m_currentSlot.load(std::memory_order_relaxed)].m_stages[static_cast<std::size_t>(a_stage)];
+        histogram.m_buckets[BucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+        histogram.m_totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        if (nanoseconds > histogram.m_maxNanoseconds.load(std::memory_order_relaxed)) {
+            histogram.m_maxNanoseconds.store(nanoseconds, std::memory_order_relaxed);  // Single writer (main thread)
+        }
+    }
+
+    void FrameProfiler::AddCount(FrameCounter a_counter, std::uint64_t a_amount) {
+        m_slots[m_currentSlot.load(std::memory_order_relaxed)].m_counters[static_cast<std::size_t>(a_counter)].fetch_add(a_amount, std::memory_order_relaxed);
+    }
+
+    FrameStageSummary FrameProfiler::GetSummary(FrameStage a_stage) const {
+        const auto stage = static_cast<std::size_t>(a_stage);
+        std::array<std::uint64_t, kBucketCount> buckets{};
+        std::uint64_t count = 0;
+        std::uint64_t totalNanoseconds = 0;
+        std::uint64_t maxNanoseconds = 0;
+        for (const auto& slot : m_slots) {
+            const Histogram& histogram = slot.m_stages[stage];
+            for (std::size_t i = 0; i < kBucketCount; ++i) {
+                const std::uint32_t bucketCount = histogram.m_buckets[i].load(std::memory_order_relaxed);
+                buckets[i] += bucketCount;
+                count += bucketCount;
+            }
+            totalNanoseconds += histogram.m_totalNanoseconds.load(std::memory_order_relaxed);
+            maxNanoseconds = std::max(maxNanoseconds, histogram.m_maxNanoseconds.load(std::memory_order_relaxed));
+        }
+
+        FrameStageSummary summary;
+        if (count == 0) {
+            return summary;
+        }
+
+        // Percentiles from the bucket midpoints, capped by the exact maximum
+        auto percentile = [&](double a_fraction) {
+            const auto rank = static_cast<std::uint64_t>(a_fraction * static_cast<double>(count - 1)) + 1;
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < kBucketCount; ++i) {
+                seen += buckets[i];
+                if (seen >= rank) {
+                    return std::min(BucketValue(i), static_cast<double>(maxNanoseconds)) / 1000.0;
+                }
+            }
+            return static_cast<double>(maxNanoseconds) / 1000.0;
+        };
+
+        summary.m_count = count;
+        summary.m_mean = static_cast<double>(totalNanoseconds) / static_cast<double>(count) / 1000.0;
+        summary.m_p50 = percentile(0.5);
+        summary.m_p90 = percentile(0.9);
+        summary.m_p99 = percentile(0.99);
+        summary.m_p999 = percentile(0.999);
+        summary.m_max = static_cast<double>(maxNanoseconds) / 1000.0;
+        return summary;
+    }
+
+    std::uint64_t FrameProfiler::GetCounter(FrameCounter a_counter) const {
+        std::uint64_t total = 0;
+        for (const auto& slot : m_slots) {
+            total += slot.m_counters[static_cast<std::size_t>(a_counter)].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void FrameProfiler::LogSummary() const {
+        if (!IsEnabled()) {
+            return;
+        }
+
+        log::info("FrameProfiler: stage times in microseconds over the last {:.1f} s", std::chrono::duration<float>(m_slotDuration * kSlotCount).count());
+        for (std::size_t i = 0; i < kStageCount; ++i) {
+            const auto stage = static_cast<FrameStage>(i);
+            const FrameStageSummary summary = GetSummary(stage);
+            if (summary.m_count == 0) {
+                continue;
+            }
+            log::info("  {:<16} n={:<7} mean={:8.2f} p50={:8.2f} p90={:8.2f} p99={:8.2f} p99.9={:8.2f} max={:8.2f}",
+                GetStageName(stage), summary.m_count, summary.m_mean, summary.m_p50, summary.m_p90, summary.m_p99, summary.m_p999, summary.m_max);
+        }
+        for (std::size_t i = 0; i < kCounterCount; ++i) {
+            const auto counter = static_cast<FrameCounter>(i);
+            log::info("  {:<24} {}", GetCounterName(counter), GetCounter(counter));
+        }
+    }
+
+    void FrameProfiler::OnTimelineStop() const {
+        if (m_logOnStop) {
+            LogSummary();
+        }
+    }
+
+    const char* FrameProfiler::GetStageName(FrameStage a_stage) {
+        switch (a_stage) {
+        case FrameStage::kUpdate:
+            return "Update";
+        case FrameStage::kLockWait:
+            return "LockWait";
+        case FrameStage::kShowMenus:
+            return "ShowMenus";
+        case FrameStage::kSample:
+            return "Sample";
+        case FrameStage::kGroundHeight:
+            return "GroundHeight";
+        case FrameStage::kPropagatePlayer:
+            return "PropagatePlayer";
+        case FrameStage::kAudioListener:
+            return "AudioListener";
+        case FrameStage::kRecord:
+            return "Record";
+        case FrameStage::kCommands:
+            return "Commands";
+        default:
+            return "Unknown";
+        }
+    }
+
+    const char* FrameProfiler::GetCounterName(FrameCounter a_counter) {
+        switch (a_counter) {
+        case FrameCounter::kFrames:
+            return "Frames";
+        case FrameCounter::kReferenceRequests:
+            return "ReferenceRequests";
+        case FrameCounter::kReferenceResolutions:
+            return "ReferenceResolutions";
+        case FrameCounter::kSegmentSearches:
+            return "SegmentSearches";
+        default:
+            return "Unknown";
+        }
+    }
+
+    std::size_t FrameProfiler::BucketIndex(std::uint64_t a_nanoseconds) {
+        if (a_nanoseconds < kSubBucketCount) {
+            return static_cast<std::size_t>(a_nanoseconds);
+        }
+        // Exponent of the highest set bit, then the next kSubBucketBits bits below it
+        const std::size_t exponent = static_cast<std::size_t>(std::bit_width(a_nanoseconds)) - 1;
+        if (exponent > kMaxExponent) {
+            return kBucketCount - 1;
+        }
+        const auto subBucket = static_cast<std::size_t>((a_nanoseconds >> (exponent - kSubBucketBits)) & (kSubBucketCount - 1));
+        return kSubBucketCount + (exponent - kSubBucketBits) * kSubBucketCount + subBucket;
+    }
+
+    double FrameProfiler::BucketValue(std::size_t a_index) {
+        if (a_index < kSubBucketCount) {
+            return static_cast<double>(a_index);
+        }
+        const std::size_t exponent = (a_index - kSubBucketCount) / kSubBucketCount + kSubBucketBits;
+        const std::size_t subBucket = (a_index - kSubBucketCount) % kSubBucketCount;
+        const double width = static_cast<double>(std::uint64_t{ 1 } << (exponent - kSubBucketBits));
+        return static_cast<double>(kSubBucketCount + subBucket) * width + 0.5 * width;
+    }
+
+    void FrameProfiler::ClearSlot(Slot& a_slot) {
+        for (auto& histogram : a_slot.m_stages) {
+            for (auto& bucket : histogram.m_buckets) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+            histogram.m_totalNanoseconds.store(0, std::memory_order_relaxed);
+            histogram.m_maxNanoseconds.store(0, std::memory_order_relaxed);
+        }
+        for (auto& counter : a_slot.m_counters) {
+            counter.store(0, std::memory_order_relaxed);
+        }
+    }
+} // namespace FCFW
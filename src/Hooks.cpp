@@ -1,5 +1,6 @@
 #include "Hooks.h"
 #include "TimelineManager.h"
+#include "TraceRecorder.h"
 #include <_ts_SKSEFunctions.h>
 #include <DbgHelp.h>
 
@@ -39,6 +40,8 @@ namespace Hooks
 
 	void MainUpdateHook::Nullsub()
 	{
+		FCFW::TraceRecorder::Scope traceScope("MainUpdateHook::Nullsub");
+
 		_Nullsub();
 
 		ToggleFreeCameraHook::HandleDeferredFreeCameraToggle();
@@ -75,12 +78,13 @@ log::info("{}: no coords", __FUNCTION__);
 
 	void LookHook::ProcessThumbstick(RE::LookHandler* a_this, RE::ThumbstickEvent* a_event, RE::PlayerControlsData* a_data)
 	{
+		FCFW::TraceRecorder::Scope traceScope("LookHook::ProcessThumbstick");
 		auto& timelineManager = FCFW::TimelineManager::GetSingleton();
 
 		if (!RE::UI::GetSingleton()->GameIsPaused()) {
 			timelineManager.SetUserTurning(true);
-			size_t activeID = timelineManager.GetActiveTimelineID();
-			if (activeID != 0 && timelineManager.IsPlaybackRunning(activeID) && !timelineManager.IsUserRotationAllowed(activeID)) {
+			const FCFW::PlaybackSnapshot playback = timelineManager.GetPlaybackSnapshot();
+			if (playback.m_isPlaybackRunning && !playback.m_allowUserRotation) {
 				return; // ignore look input during playback
 			}
 		}
@@ -90,12 +94,13 @@ log::info("{}: no coords", __FUNCTION__);
 
 	void LookHook::ProcessMouseMove(RE::LookHandler* a_this, RE::MouseMoveEvent* a_event, RE::PlayerControlsData* a_data)
 	{
+		FCFW::TraceRecorder::Scope traceScope("LookHook::ProcessMouseMove");
 		auto& timelineManager = FCFW::TimelineManager::GetSingleton();
 
 		if (!RE::UI::GetSingleton()->GameIsPaused()) {
 			timelineManager.SetUserTurning(true);
-			size_t activeID = timelineManager.GetActiveTimelineID();
-			if (activeID != 0 && timelineManager.IsPlaybackRunning(activeID) && !timelineManager.IsUserRotationAllowed(activeID)) {
+			const FCFW::PlaybackSnapshot playback = timelineManager.GetPlaybackSnapshot();
+			if (playback.m_isPlaybackRunning && !playback.m_allowUserRotation) {
 				return; // ignore look input during playback
 			}
 		}
@@ -105,9 +110,9 @@ log::info("{}: no coords", __FUNCTION__);
 
 	void MovementHook::ProcessThumbstick(RE::MovementHandler* a_this, RE::ThumbstickEvent* a_event, RE::PlayerControlsData* a_data)
 	{
+		FCFW::TraceRecorder::Scope traceScope("MovementHook::ProcessThumbstick");
 		auto& timelineManager = FCFW::TimelineManager::GetSingleton();
-		size_t activeID = timelineManager.GetActiveTimelineID();
-		if (a_event && a_event->IsLeft() && activeID != 0 && timelineManager.IsPlaybackRunning(activeID) && !RE::UI::GetSingleton()->GameIsPaused()) {
+		if (a_event && a_event->IsLeft() && timelineManager.GetPlaybackSnapshot().m_isPlaybackRunning && !RE::UI::GetSingleton()->GameIsPaused()) {
 			return; // ignore movement input during playback
 		}
 
@@ -116,6 +121,7 @@ log::info("{}: no coords", __FUNCTION__);
 
 	void MovementHook::ProcessButton(RE::MovementHandler* a_this, RE::ButtonEvent* a_event, RE::PlayerControlsData* a_data)
 	{
+		FCFW::TraceRecorder::Scope traceScope("MovementHook::ProcessButton");
 		bool bRelevant = false;
 		if (a_event)
 		{
@@ -130,8 +136,7 @@ log::info("{}: no coords", __FUNCTION__);
 			}
 		}
 		auto& timelineManager = FCFW::TimelineManager::GetSingleton();
-		size_t activeID = timelineManager.GetActiveTimelineID();
-		if (bRelevant && activeID != 0 && timelineManager.IsPlaybackRunning(activeID) && !RE::UI::GetSingleton()->GameIsPaused()) {
+		if (bRelevant && timelineManager.GetPlaybackSnapshot().m_isPlaybackRunning && !RE::UI::GetSingleton()->GameIsPaused()) {
 			return; // ignore movement input during playback
 		}
 
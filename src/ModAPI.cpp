@@ -2,6 +2,8 @@
 #include "TimelineManager.h"
 #include "CameraPath.h"
 #include "CameraTypes.h"
+#include "FrameProfiler.h"
+#include "TimelineBuilder.h"
 
 Messaging::FCFWInterface::FCFWInterface() noexcept {
 	apiTID = GetCurrentThreadId();
@@ -187,3 +189,81 @@ bool Messaging::FCFWInterface::ExportTimeline(SKSE::PluginHandle a_pluginHandle,
     return FCFW::TimelineManager::GetSingleton().ExportTimeline(a_pluginHandle, a_timelineID, a_filePath);
 }
 
+bool Messaging::FCFWInterface::SampleTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const float* a_times, size_t a_count, RE::NiPoint3* a_translations, RE::NiPoint3* a_rotations, float* a_fovs) const noexcept {
+    if (!a_times && a_count > 0) {
+        return false;
+    }
+    return FCFW::TimelineManager::GetSingleton().SampleTimeline(a_pluginHandle, a_timelineID,
+        std::span<const float>(a_times, a_count),
+        a_translations ? std::span<RE::NiPoint3>(a_translations, a_count) : std::span<RE::NiPoint3>(),
+        a_rotations ? std::span<RE::NiPoint3>(a_rotations, a_count) : std::span<RE::NiPoint3>(),
+        a_fovs ? std::span<float>(a_fovs, a_count) : std::span<float>());
+}
+
+bool Messaging::FCFWInterface::BakeTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_sampleRate, float a_tolerance) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().BakeTimeline(a_pluginHandle, a_timelineID, a_sampleRate, a_tolerance);
+}
+
+bool Messaging::FCFWInterface::IsTimelineBaked(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().IsTimelineBaked(a_pluginHandle, a_timelineID);
+}
+
+bool Messaging::FCFWInterface::StartPlaybackAtConstantSpeed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, float a_startTime) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().StartPlayback(a_pluginHandle, a_timelineID, a_speed, a_globalEaseIn, a_globalEaseOut, a_useDuration, a_duration, a_startTime, true);
+}
+
+float Messaging::FCFWInterface::GetTranslationPathLength(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().GetTranslationPathLength(a_pluginHandle, a_timelineID);
+}
+
+bool Messaging::FCFWInterface::AutoRetimeByDistance(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().AutoRetimeByDistance(a_pluginHandle, a_timelineID);
+}
+
+bool Messaging::FCFWInterface::GetFrameStageStats(FCFW_API::FrameStage a_stage, FCFW_API::FrameStageStats* a_stats) const noexcept {
+    if (!a_stats || !FCFW::FrameProfiler::IsEnabled() || static_cast<int>(a_stage) < 0 || static_cast<int>(a_stage) >= static_cast<int>(FCFW::FrameStage::kCount)) {
+        return false;
+    }
+    const FCFW::FrameStageSummary summary = FCFW::FrameProfiler::GetSingleton().GetSummary(static_cast<FCFW::FrameStage>(a_stage));
+    *a_stats = FCFW_API::FrameStageStats{ summary.m_count, summary.m_mean, summary.m_p50, summary.m_p90, summary.m_p99, summary.m_p999, summary.m_max };
+    return true;
+}
+
+uint64_t Messaging::FCFWInterface::GetFrameCounter(FCFW_API::FrameCounter a_counter) const noexcept {
+    if (!FCFW::FrameProfiler::IsEnabled() || static_cast<int>(a_counter) < 0 || static_cast<int>(a_counter) >= static_cast<int>(FCFW::FrameCounter::kCount)) {
+        return 0;
+    }
+    return FCFW::FrameProfiler::GetSingleton().GetCounter(static_cast<FCFW::FrameCounter>(a_counter));
+}
+
+bool Messaging::FCFWInterface::StartTrace(const char* a_filePath) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().StartTrace(a_filePath);
+}
+
+bool Messaging::FCFWInterface::FlushTrace() const noexcept {
+    return FCFW::TimelineManager::GetSingleton().FlushTrace();
+}
+
+void Messaging::FCFWInterface::StopTrace() const noexcept {
+    FCFW::TimelineManager::GetSingleton().StopTrace();
+}
+
+uint64_t Messaging::FCFWInterface::QueueCommand(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().QueueCommand(a_pluginHandle, a_command);
+}
+
+FCFW_API::CommandStatus Messaging::FCFWInterface::GetCommandResult(uint64_t a_ticket, int* a_result) const noexcept {
+    return FCFW::TimelineManager::GetSingleton().GetCommandResult(a_ticket, a_result);
+}
+
+FCFW_API::CommandStatus Messaging::FCFWInterface::WaitForCommand(uint64_t a_ticket, int* a_result, uint32_t a_timeoutMs) const noexcept {
+    // FCFW's thread applies the queue, waiting on it would never finish
+    if (GetCurrentThreadId() == apiTID) {
+        return FCFW::TimelineManager::GetSingleton().GetCommandResult(a_ticket, a_result);
+    }
+    return FCFW::TimelineManager::GetSingleton().WaitForCommand(a_ticket, a_result, a_timeoutMs);
+}
+
+FCFW_API::ITimelineBuilder* Messaging::FCFWInterface::CreateTimelineBuilder(SKSE::PluginHandle a_pluginHandle) const noexcept {
+    return new (std::nothrow) FCFW::TimelineBuilder(a_pluginHandle);
+}
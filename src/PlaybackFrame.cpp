@@ -0,0 +1,46 @@
+#include "PlaybackFrame.h"
+
+namespace FCFW {
+    PlaybackFrame AdvancePlayback(Timeline& a_timeline, const PlaybackFrameSettings& a_settings, float a_realDeltaTime,
+                                  const LandHeightFunction& a_getLandHeight) {
+        a_timeline.UpdatePlayback(a_realDeltaTime * a_settings.m_speed);
+
+        // One clock for all tracks, global easing applied
+        const float sampleTime = a_timeline.GetSampleTime();
+
+        PlaybackFrame frame;
+        frame.m_hasFOV = a_timeline.GetFOVPointCount() > 0;
+
+        const TimelineBake* bake = a_timeline.GetBake();
+        if (a_settings.m_constantSpeed) {
+            // Position comes from the arc-length parameterization, which neither the bake nor the shared keys store
+            frame.m_position = a_timeline.GetTranslationAtConstantSpeed(sampleTime);
+            if (bake) {
+                frame.m_rotation = bake->GetRotation(sampleTime);
+                frame.m_fov = frame.m_hasFOV ? bake->GetFOV(sampleTime) : 0.0f;
+            } else {
+                frame.m_rotation = a_timeline.GetRotation(sampleTime);
+                frame.m_fov = frame.m_hasFOV ? a_timeline.GetFOV(sampleTime) : 0.0f;
+            }
+        } else if (bake) {
+            frame.m_position = bake->GetTranslation(sampleTime);
+            frame.m_rotation = bake->GetRotation(sampleTime);
+            frame.m_fov = frame.m_hasFOV ? bake->GetFOV(sampleTime) : 0.0f;
+        } else if (a_timeline.HasSharedKeys()) {
+            a_timeline.SampleSharedKeys(sampleTime, frame.m_position, frame.m_rotation, frame.m_fov);
+        } else {
+            frame.m_position = a_timeline.GetTranslation(sampleTime);
+            frame.m_rotation = a_timeline.GetRotation(sampleTime);
+            frame.m_fov = frame.m_hasFOV ? a_timeline.GetFOV(sampleTime) : 0.0f;
+        }
+
+        if (a_settings.m_followGround && a_getLandHeight) {
+            const float landHeight = a_getLandHeight(frame.m_position);
+            if (frame.m_position.z - landHeight < a_settings.m_minHeightAboveGround) {
+                frame.m_position.z = landHeight + a_settings.m_minHeightAboveGround;
+            }
+        }
+
+        return frame;
+    }
+} // namespace FCFW
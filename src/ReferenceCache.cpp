@@ -0,0 +1,276 @@
+#include "ReferenceCache.h"
+#include "FrameCapture.h"
+#include "FrameProfiler.h"
+#include "_ts_SKSEFunctions.h"
+
+namespace FCFW {
+    namespace {
+        struct CacheEntry {
+            RE::TESObjectREFR* m_reference;
+            BodyPart m_bodyPart;
+            bool m_isOffsetRelative;
+            ResolvedReference m_resolved;
+        };
+
+        struct FrameState {
+            bool m_active = false;
+            std::vector<CacheEntry> m_entries;  // A handful of references per frame: linear search beats hashing
+            ReferenceCache::Stats m_current;
+            ReferenceCache::Stats m_last;
+        };
+
+        thread_local FrameState t_frame;
+
+        constexpr float kAxisTolerance = 0.001f;      // Mapping entries must be within this of -1, 0 or +1
+        constexpr float kRotationTolerance = 0.001f;  // Radians, derived vs library body part rotation
+        constexpr float kInformativeAngle = 0.05f;    // Pitch and roll must both exceed this to verify the rotation convention
+
+        // a_out = (a_transpose ? R^T : R) * F, where F has columns right, forward, up
+        void MultiplyFrame(const RE::NiMatrix3& a_rotation, bool a_transpose, const RE::NiPoint3& a_right, const RE::NiPoint3& a_forward,
+                           const RE::NiPoint3& a_up, float a_out[3][3]) {
+            const RE::NiPoint3* columns[3] = { &a_right, &a_forward, &a_up };
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) {
+                    const RE::NiPoint3& column = *columns[j];
+                    const float r0 = a_transpose ? a_rotation.entry[0][i] : a_rotation.entry[i][0];
+                    const float r1 = a_transpose ? a_rotation.entry[1][i] : a_rotation.entry[i][1];
+                    const float r2 = a_transpose ? a_rotation.entry[2][i] : a_rotation.entry[i][2];
+                    a_out[i][j] = r0 * column.x + r1 * column.y + r2 * column.z;
+                }
+            }
+        }
+
+        // Snaps a matrix to a signed axis permutation; false if it is not one
+        bool SnapToAxisPermutation(float a_matrix[3][3]) {
+            for (int i = 0; i < 3; ++i) {
+                int units = 0;
+                for (int j = 0; j < 3; ++j) {
+                    float& value = a_matrix[i][j];
+                    if (std::abs(std::abs(value) - 1.0f) < kAxisTolerance) {
+                        value = value > 0.0f ? 1.0f : -1.0f;
+                        ++units;
+                    } else if (std::abs(value) < kAxisTolerance) {
+                        value = 0.0f;
+                    } else {
+                        return false;
+                    }
+                }
+                if (units != 1) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // Euler angles (pitch=x, roll=y, yaw=z) of a body part frame, same convention as the camera
+        RE::NiPoint3 FrameToRotation(const ResolvedReference& a_frame) {
+            return RE::NiPoint3{
+                -std::asin(std::clamp(a_frame.m_forward.z, -1.0f, 1.0f)),
+                std::atan2(-a_frame.m_right.z, a_frame.m_up.z),
+                std::atan2(a_frame.m_forward.x, a_frame.m_forward.y)};
+        }
+
+        ResolvedReference ResolveDirect(RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative) {
+            if (FrameReplay::GetSingleton().IsActive()) {
+                return FrameReplay::GetSingleton().ResolveReference(a_reference, a_bodyPart, a_isOffsetRelative);
+            }
+
+            ResolvedReference result;
+            if (!a_reference || !a_reference->Is3DLoaded()) {
+                return result;
+            }
+            result.m_isLoaded = true;
+
+            RE::Actor* actor = a_reference->As<RE::Actor>();
+            if (a_bodyPart != BodyPart::kNone && actor &&
+                BodyPartNodeCache::GetSingleton().Resolve(actor, a_bodyPart, a_isOffsetRelative, result)) {
+                // Body part node position, and its coordinate frame and rotation in world space
+                return result;
+            }
+
+            // Root position (no body part, or body part node not found)
+            result.m_position = a_reference->GetPosition();
+
+            if (!a_isOffsetRelative) {
+                return result;
+            }
+
+            if (actor) {
+                // No body part (or node not found): actor heading, yaw only
+                result.m_rotation = RE::NiPoint3{0.0f, 0.0f, actor->GetHeading(false)};
+            } else {
+                // Not an actor, use reference angles
+                result.m_rotation = RE::NiPoint3{a_reference->GetAngleX(), a_reference->GetAngleY(), a_reference->GetAngleZ()};
+            }
+            return result;
+        }
+    }
+
+    ReferenceCache::FrameScope::FrameScope() {
+        t_frame.m_active = true;
+        t_frame.m_entries.clear();
+        t_frame.m_current = Stats{};
+    }
+
+    ReferenceCache::FrameScope::~FrameScope() {
+        t_frame.m_active = false;
+        t_frame.m_entries.clear();
+        t_frame.m_last = t_frame.m_current;
+        FrameProfiler::Count(FrameCounter::kReferenceRequests, t_frame.m_current.m_requests);
+        FrameProfiler::Count(FrameCounter::kReferenceResolutions, t_frame.m_current.m_resolutions);
+        if (t_frame.m_current.m_requests > 0) {
+            log::trace("ReferenceCache: {} reference requests, {} resolutions this frame", t_frame.m_current.m_requests, t_frame.m_current.m_resolutions);
+        }
+    }
+
+    ResolvedReference ReferenceCache::Resolve(RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, bool a_isOffsetRelative) {
+        if (!t_frame.m_active) {
+            return ResolveDirect(a_reference, a_bodyPart, a_isOffsetRelative);
+        }
+
+        ++t_frame.m_current.m_requests;
+        for (const auto& entry : t_frame.m_entries) {
+            if (entry.m_reference == a_reference && entry.m_bodyPart == a_bodyPart && entry.m_isOffsetRelative == a_isOffsetRelative) {
+                return entry.m_resolved;
+            }
+        }
+
+        ++t_frame.m_current.m_resolutions;
+        auto& entry = t_frame.m_entries.emplace_back(CacheEntry{a_reference, a_bodyPart, a_isOffsetRelative, ResolveDirect(a_reference, a_bodyPart, a_isOffsetRelative)});
+        FrameCapture::GetSingleton().RecordReference(a_reference, a_bodyPart, a_isOffsetRelative, entry.m_resolved);
+        return entry.m_resolved;
+    }
+
+    ReferenceCache::Stats ReferenceCache::GetLastFrameStats() {
+        return t_frame.m_last;
+    }
+
+    void BodyPartNodeCache::Register() {
+        auto* eventSourceHolder = RE::ScriptEventSourceHolder::GetSingleton();
+        if (!eventSourceHolder) {
+            log::error("{}: ScriptEventSourceHolder not available, body part nodes are only refreshed on 3D reset", __FUNCTION__);
+            return;
+        }
+        eventSourceHolder->AddEventSink<RE::TESObjectLoadedEvent>(this);
+        log::info("{}: Registered for object load events", __FUNCTION__);
+    }
+
+    RE::BSEventNotifyControl BodyPartNodeCache::ProcessEvent(const RE::TESObjectLoadedEvent* a_event, RE::BSTEventSource<RE::TESObjectLoadedEvent>*) {
+        if (a_event) {
+            std::lock_guard<std::mutex> lock(m_lock);
+            std::erase_if(m_entries, [formID = a_event->formID](const Entry& entry) { return entry.m_formID == formID; });
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    bool BodyPartNodeCache::Resolve(RE::Actor* a_actor, BodyPart a_bodyPart, bool a_withOrientation, ResolvedReference& a_out) {
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        Entry& entry = FindOrAddEntry(a_actor, a_bodyPart);
+        if (!entry.m_node) {
+            return false;
+        }
+
+        a_out.m_position = entry.m_node->world.translate;
+        if (a_withOrientation) {
+            ResolveFrame(entry, a_actor, a_out);
+            a_out.m_hasBodyFrame = true;
+            a_out.m_rotation = ResolveRotation(entry, a_actor, a_out);
+        }
+        return true;
+    }
+
+    BodyPartNodeCache::Entry& BodyPartNodeCache::FindOrAddEntry(RE::Actor* a_actor, BodyPart a_bodyPart) {
+        const RE::FormID formID = a_actor->GetFormID();
+        auto it = std::find_if(m_entries.begin(), m_entries.end(), [&](const Entry& entry) {
+            return entry.m_actor == a_actor && entry.m_formID == formID && entry.m_bodyPart == a_bodyPart;
+        });
+        Entry& entry = (it != m_entries.end()) ? *it : m_entries.emplace_back();
+
+        RE::NiAVObject* root = a_actor->Get3D();
+        if (it != m_entries.end() && entry.m_root == root) {
+            return entry;
+        }
+
+        // New entry or 3D reset: walk the body part data once
+        entry = Entry{};
+        entry.m_actor = a_actor;
+        entry.m_formID = formID;
+        entry.m_bodyPart = a_bodyPart;
+        entry.m_root = root;
+        if (root) {
+            entry.m_node.reset(_ts_SKSEFunctions::GetTargetPoint(a_actor, BodyPartToLimbEnum(a_bodyPart)));
+        }
+        return entry;
+    }
+
+    void BodyPartNodeCache::ResolveFrame(Entry& a_entry, RE::Actor* a_actor, ResolvedReference& a_out) {
+        const RE::NiMatrix3& rotation = a_entry.m_node->world.rotate;
+
+        if (a_entry.m_frameSource == FrameSource::kColumns || a_entry.m_frameSource == FrameSource::kRows) {
+            const bool transpose = a_entry.m_frameSource == FrameSource::kRows;
+            const float (&mapping)[3][3] = a_entry.m_frameMapping;
+            RE::NiPoint3* columns[3] = { &a_out.m_right, &a_out.m_forward, &a_out.m_up };
+            for (int j = 0; j < 3; ++j) {
+                float values[3];
+                for (int i = 0; i < 3; ++i) {
+                    const float r0 = transpose ? rotation.entry[0][i] : rotation.entry[i][0];
+                    const float r1 = transpose ? rotation.entry[1][i] : rotation.entry[i][1];
+                    const float r2 = transpose ? rotation.entry[2][i] : rotation.entry[i][2];
+                    values[i] = r0 * mapping[0][j] + r1 * mapping[1][j] + r2 * mapping[2][j];
+                }
+                *columns[j] = RE::NiPoint3{ values[0], values[1], values[2] };
+            }
+            return;
+        }
+
+        _ts_SKSEFunctions::GetBodyPartCoordinateFrame(a_actor, BodyPartToLimbEnum(a_entry.m_bodyPart), a_out.m_forward, a_out.m_right, a_out.m_up);
+        if (a_entry.m_frameSource != FrameSource::kUnknown) {
+            return;
+        }
+
+        // The library frame is a per-skeleton axis remap of the node rotation (see MappingRotationMatrixToBodyPart*.md).
+        // Capture it once; a node rotation that fits both conventions is ambiguous, so sample again next time.
+        float columnMapping[3][3];
+        float rowMapping[3][3];
+        MultiplyFrame(rotation, true, a_out.m_right, a_out.m_forward, a_out.m_up, columnMapping);
+        MultiplyFrame(rotation, false, a_out.m_right, a_out.m_forward, a_out.m_up, rowMapping);
+        const bool columnsFit = SnapToAxisPermutation(columnMapping);
+        const bool rowsFit = SnapToAxisPermutation(rowMapping);
+        if (columnsFit && rowsFit) {
+            return;
+        }
+        if (columnsFit) {
+            a_entry.m_frameSource = FrameSource::kColumns;
+            std::memcpy(a_entry.m_frameMapping, columnMapping, sizeof(columnMapping));
+        } else if (rowsFit) {
+            a_entry.m_frameSource = FrameSource::kRows;
+            std::memcpy(a_entry.m_frameMapping, rowMapping, sizeof(rowMapping));
+        } else {
+            a_entry.m_frameSource = FrameSource::kLibrary;
+            log::info("{}: Body part frame of actor 0x{:X} is not an axis remap of its node, using library lookups", __FUNCTION__, a_entry.m_formID);
+        }
+    }
+
+    RE::NiPoint3 BodyPartNodeCache::ResolveRotation(const Entry& a_entry, RE::Actor* a_actor, const ResolvedReference& a_resolvedFrame) {
+        if (m_rotationSource == RotationSource::kFromFrame) {
+            return FrameToRotation(a_resolvedFrame);
+        }
+
+        RE::NiPoint3 rotation = _ts_SKSEFunctions::GetBodyPartRotation(a_actor, BodyPartToLimbEnum(a_entry.m_bodyPart));
+        if (m_rotationSource == RotationSource::kLibrary) {
+            return rotation;
+        }
+
+        // Verify the library convention once, on a pose where pitch and roll are both distinguishable
+        if (std::abs(rotation.x) > kInformativeAngle && std::abs(rotation.y) > kInformativeAngle && std::abs(rotation.x) < PI / 2.0f - kInformativeAngle) {
+            const RE::NiPoint3 derived = FrameToRotation(a_resolvedFrame);
+            const bool matches = std::abs(_ts_SKSEFunctions::NormalRelativeAngle(derived.x - rotation.x)) < kRotationTolerance &&
+                                 std::abs(_ts_SKSEFunctions::NormalRelativeAngle(derived.y - rotation.y)) < kRotationTolerance &&
+                                 std::abs(_ts_SKSEFunctions::NormalRelativeAngle(derived.z - rotation.z)) < kRotationTolerance;
+            m_rotationSource = matches ? RotationSource::kFromFrame : RotationSource::kLibrary;
+            log::info("{}: Body part rotation {} derived from the body part frame", __FUNCTION__, matches ? "is" : "is not");
+        }
+        return rotation;
+    }
+} // namespace FCFW
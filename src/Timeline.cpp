@@ -2,72 +2,410 @@
 
 namespace FCFW
 {
+	namespace
+	{
+		constexpr size_t kMaxBakeSamples = size_t{ 1 } << 22;  // ~128 MB of samples
+		constexpr float kBakeSeedSpacingFactor = 32.0f;         // Adaptive seed grid spacing in multiples of the minimum spacing
+
+		struct BakeSample
+		{
+			float time;
+			RE::NiPoint3 translation;
+			RE::NiPoint3 rotation;
+			float fov;
+		};
+
+		RE::NiPoint3 LerpRotation(const RE::NiPoint3& a_from, const RE::NiPoint3& a_to, float a_t)
+		{
+			return RE::NiPoint3(
+				_ts_SKSEFunctions::NormalRelativeAngle(a_from.x + _ts_SKSEFunctions::NormalRelativeAngle(a_to.x - a_from.x) * a_t),
+				_ts_SKSEFunctions::NormalRelativeAngle(a_from.y + _ts_SKSEFunctions::NormalRelativeAngle(a_to.y - a_from.y) * a_t),
+				_ts_SKSEFunctions::NormalRelativeAngle(a_from.z + _ts_SKSEFunctions::NormalRelativeAngle(a_to.z - a_from.z) * a_t));
+		}
+
+		// Largest deviation between a_value and the linear reconstruction from a_from to a_to,
+		// in game units for translation and degrees for rotation and FOV
+		float ReconstructionError(const BakeSample& a_from, const BakeSample& a_to, const BakeSample& a_value)
+		{
+			const float t = (a_value.time - a_from.time) / (a_to.time - a_from.time);
+			const RE::NiPoint3 translation = a_from.translation + (a_to.translation - a_from.translation) * t;
+			const RE::NiPoint3 rotation = LerpRotation(a_from.rotation, a_to.rotation, t);
+			const float fov = a_from.fov + (a_to.fov - a_from.fov) * t;
+
+			const float rotationError = std::max({
+				std::abs(_ts_SKSEFunctions::NormalRelativeAngle(a_value.rotation.x - rotation.x)),
+				std::abs(_ts_SKSEFunctions::NormalRelativeAngle(a_value.rotation.y - rotation.y)),
+				std::abs(_ts_SKSEFunctions::NormalRelativeAngle(a_value.rotation.z - rotation.z))
+			});
+			return std::max({ (a_value.translation - translation).Length(), rotationError * 180.0f / PI, std::abs(a_value.fov - fov) });
+		}
+	}
+
+	size_t TimelineBake::FindSample(float a_time, float& a_progress) const
+	{
+		const size_t sampleCount = m_times.size();
+		if (sampleCount < 2 || a_time <= 0.0f) {
+			a_progress = 0.0f;
+			return 0;
+		}
+		if (a_time >= m_duration) {
+			a_progress = 1.0f;
+			return sampleCount - 2;
+		}
+
+		// Cells are at most one sample spacing wide, so at most one step forward is needed
+		const size_t cell = std::min(static_cast<size_t>(a_time / m_cellWidth), m_cellStart.size() - 1);
+		size_t index = m_cellStart[cell];
+		while (index + 2 < sampleCount && m_times[index + 1] <= a_time) {
+			++index;
+		}
+		a_progress = std::clamp((a_time - m_times[index]) / (m_times[index + 1] - m_times[index]), 0.0f, 1.0f);
+		return index;
+	}
+
+	RE::NiPoint3 TimelineBake::GetTranslation(float a_time) const
+	{
+		if (m_times.size() < 2) {
+			return m_translations.empty() ? RE::NiPoint3{} : m_translations.front();
+		}
+		float progress;
+		const size_t index = FindSample(a_time, progress);
+		return m_translations[index] + (m_translations[index + 1] - m_translations[index]) * progress;
+	}
+
+	RE::NiPoint3 TimelineBake::GetRotation(float a_time) const
+	{
+		if (m_times.size() < 2) {
+			return m_rotations.empty() ? RE::NiPoint3{} : m_rotations.front();
+		}
+		float progress;
+		const size_t index = FindSample(a_time, progress);
+		return LerpRotation(m_rotations[index], m_rotations[index + 1], progress);
+	}
+
+	float TimelineBake::GetFOV(float a_time) const
+	{
+		if (m_times.size() < 2) {
+			return m_fovs.empty() ? 80.0f : m_fovs.front();
+		}
+		float progress;
+		const size_t index = FindSample(a_time, progress);
+		return m_fovs[index] + (m_fovs[index + 1] - m_fovs[index]) * progress;
+	}
+
+	size_t SharedKeyBlock::FindSegment(float a_time) const
+	{
+		// First point index with time >= a_time, cursor fast path as in TimelineTrack::FindSegment
+		const size_t pointCount = m_times.size();
+		auto containsTime = [&](size_t a_index) {
+			if (a_index > pointCount) {
+				return false;
+			}
+			bool afterPrev = a_index == 0 || m_times[a_index - 1] < a_time;
+			bool notAfterCurrent = a_index == pointCount || a_time <= m_times[a_index];
+			return afterPrev && notAfterCurrent;
+		};
+
+		if (containsTime(m_cursor)) {
+			return m_cursor;
+		}
+		if (containsTime(m_cursor + 1)) {
+			return ++m_cursor;
+		}
+		FrameProfiler::Count(FrameCounter::kSegmentSearches);
+		m_cursor = static_cast<size_t>(std::distance(m_times.begin(), std::lower_bound(m_times.begin(), m_times.end(), a_time)));
+		return m_cursor;
+	}
+
+	void SharedKeyBlock::Evaluate(float a_time, RE::NiPoint3& a_translation, RE::NiPoint3& a_rotation, float& a_fov) const
+	{
+		// Segment and progress, same rules as TimelineTrack::GetSegmentAtTime
+		const size_t pointCount = m_times.size();
+		size_t index = 0;
+		float progress = 0.0f;
+		if (m_hasLoopSegment && a_time > m_times.back()) {
+			index = pointCount;
+			progress = std::clamp((a_time - m_times.back()) / m_loopTimeOffset, 0.0f, 1.0f);
+		} else if (const size_t targetIndex = FindSegment(a_time); targetIndex >= pointCount) {
+			index = pointCount - 1;
+			progress = 1.0f;
+		} else {
+			index = targetIndex;
+			if (targetIndex > 0) {
+				const float prevTime = m_times[targetIndex - 1];
+				const float segmentDuration = m_times[targetIndex] - prevTime;
+				progress = segmentDuration > 0.0f ? std::clamp((a_time - prevTime) / segmentDuration, 0.0f, 1.0f) : 1.0f;
+			}
+		}
+
+		const Segment& segment = m_segments[index];
+		float lanes[CubicLanes::kLaneCount];
+		if (segment.m_polynomialMask != 0) {
+			float t = progress;
+			if (segment.m_easeIn || segment.m_easeOut) {
+				t = _ts_SKSEFunctions::ApplyEasing(progress, segment.m_easeIn, segment.m_easeOut);
+			}
+			EvaluateCubicLanes(segment.m_lanes, t, lanes);
+		}
+
+		a_translation = (segment.m_polynomialMask & kTranslationLanes) ? TranslationPoint::ValueFromChannels(lanes) : segment.m_translation;
+		a_rotation = (segment.m_polynomialMask & kRotationLanes) ? RotationPoint::ValueFromChannels(lanes + 3) : segment.m_rotation;
+		a_fov = (segment.m_polynomialMask & kFOVLanes) ? FOVPoint::ValueFromChannels(lanes + 7) : segment.m_fov;
+	}
+
 	size_t Timeline::AddTranslationPoint(const TranslationPoint& a_point)
 	{
 		m_translationTrack.AddPoint(a_point);
+		m_clock.Reset();
+		Invalidate();
 		return m_translationTrack.GetPointCount();
 	}
 
 	size_t Timeline::AddRotationPoint(const RotationPoint& a_point)
 	{
 		m_rotationTrack.AddPoint(a_point);
+		m_clock.Reset();
+		Invalidate();
 		return m_rotationTrack.GetPointCount();
 	}
 
 	size_t Timeline::AddFOVPoint(const FOVPoint& a_point)
 	{
 		m_fovTrack.AddPoint(a_point);
+		m_clock.Reset();
+		Invalidate();
 		return m_fovTrack.GetPointCount();
 	}
 
+	size_t Timeline::AddTranslationPoints(std::span<const TranslationPoint> a_points)
+	{
+		m_translationTrack.AddPoints(a_points);
+		m_clock.Reset();
+		Invalidate();
+		return m_translationTrack.GetPointCount();
+	}
+
+	size_t Timeline::AddRotationPoints(std::span<const RotationPoint> a_points)
+	{
+		m_rotationTrack.AddPoints(a_points);
+		m_clock.Reset();
+		Invalidate();
+		return m_rotationTrack.GetPointCount();
+	}
+
+	size_t Timeline::AddFOVPoints(std::span<const FOVPoint> a_points)
+	{
+		m_fovTrack.AddPoints(a_points);
+		m_clock.Reset();
+		Invalidate();
+		return m_fovTrack.GetPointCount();
+	}
+
+	void Timeline::SwapPoints(TranslationTrack& a_translationTrack, RotationTrack& a_rotationTrack, FOVTrack& a_fovTrack)
+	{
+		std::swap(m_translationTrack, a_translationTrack);
+		std::swap(m_rotationTrack, a_rotationTrack);
+		std::swap(m_fovTrack, a_fovTrack);
+
+		ApplyClockToTracks();
+		m_clock.Reset();
+		Invalidate();
+	}
+
+	std::shared_ptr<Timeline> Timeline::CopyWithPoints(TranslationTrack a_translationTrack, RotationTrack a_rotationTrack, FOVTrack a_fovTrack) const
+	{
+		auto copy = std::make_shared<Timeline>();
+		copy->m_translationTrack = std::move(a_translationTrack);
+		copy->m_rotationTrack = std::move(a_rotationTrack);
+		copy->m_fovTrack = std::move(a_fovTrack);
+		copy->m_clock = m_clock;
+		copy->ApplyClockToTracks();
+		copy->m_revision = m_revision;
+		copy->m_bake = m_bake;
+		copy->m_sharedKeys = m_sharedKeys;
+		return copy;
+	}
+
+	void Timeline::ApplyClockToTracks()
+	{
+		const PlaybackMode mode = m_clock.GetPlaybackMode();
+		const float loopTimeOffset = m_clock.GetLoopTimeOffset();
+		m_translationTrack.SetPlaybackMode(mode);
+		m_rotationTrack.SetPlaybackMode(mode);
+		m_fovTrack.SetPlaybackMode(mode);
+		m_translationTrack.SetLoopTimeOffset(loopTimeOffset);
+		m_rotationTrack.SetLoopTimeOffset(loopTimeOffset);
+		m_fovTrack.SetLoopTimeOffset(loopTimeOffset);
+	}
+
 	void Timeline::RemoveTranslationPoint(size_t a_index)
 	{
 		m_translationTrack.RemovePoint(a_index);
+		m_clock.Reset();
+		Invalidate();
 	}
 
 	void Timeline::RemoveRotationPoint(size_t a_index)
 	{
 		m_rotationTrack.RemovePoint(a_index);
+		m_clock.Reset();
+		Invalidate();
 	}
 
 	void Timeline::RemoveFOVPoint(size_t a_index)
 	{
 		m_fovTrack.RemovePoint(a_index);
+		m_clock.Reset();
+		Invalidate();
+	}
+
+	// Called after every edit: drops the bake and refreshes the clock's key range
+	void Timeline::Invalidate()
+	{
+		++m_revision;
+		m_bake.reset();
+		m_sharedKeys.reset();
+
+		bool hasPoints = false;
+		float lastPointTime = 0.0f;
+		auto includeTrack = [&](const auto& a_track) {
+			const size_t pointCount = a_track.GetPointCount();
+			if (pointCount > 0) {
+				const float trackLastTime = a_track.GetPointTime(pointCount - 1);
+				lastPointTime = hasPoints ? std::max(lastPointTime, trackLastTime) : trackLastTime;
+				hasPoints = true;
+			}
+		};
+		includeTrack(m_translationTrack);
+		includeTrack(m_rotationTrack);
+		includeTrack(m_fovTrack);
+		m_clock.SetKeyRange(hasPoints, lastPointTime);
 	}
 
 	void Timeline::UpdatePlayback(float a_deltaTime)
 	{
-		m_translationTrack.UpdateTimeline(a_deltaTime);
-		m_rotationTrack.UpdateTimeline(a_deltaTime);
-		m_fovTrack.UpdateTimeline(a_deltaTime);
+		m_clock.Update(a_deltaTime);
 	}
 
 	void Timeline::StartPlayback()
 	{
-		m_translationTrack.StartPlayback();
-		m_rotationTrack.StartPlayback();
-		m_fovTrack.StartPlayback();
+		// Store current camera values for kCamera points
+		m_translationTrack.UpdateCameraPoints();
+		m_rotationTrack.UpdateCameraPoints();
+		m_fovTrack.UpdateCameraPoints();
+		BuildSharedKeys();
+		m_clock.Start();
+	}
+
+	void Timeline::PrepareForPlayback()
+	{
+		BuildSharedKeys();
+	}
+
+	void Timeline::ContinuePlayback(const Timeline& a_previous)
+	{
+		m_clock.ContinueFrom(a_previous.m_clock);
+	}
+
+	void Timeline::BuildSharedKeys()
+	{
+		m_sharedKeys.reset();
+
+		// Translation and rotation keys must match exactly; FOV keys too, unless there are none
+		const size_t pointCount = m_translationTrack.GetPointCount();
+		const size_t fovPointCount = m_fovTrack.GetPointCount();
+		if (pointCount == 0 || m_rotationTrack.GetPointCount() != pointCount || (fovPointCount != 0 && fovPointCount != pointCount)) {
+			return;
+		}
+		// kReference values change every frame, so their segments have no fixed polynomial; channelized
+		// tracks interpolate per axis between their own keys instead of between the mirrored points
+		if (m_translationTrack.HasPointType(PointType::kReference) || m_rotationTrack.HasPointType(PointType::kReference) ||
+			m_fovTrack.HasPointType(PointType::kReference) || m_translationTrack.IsChannelized() || m_rotationTrack.IsChannelized()) {
+			return;
+		}
+		for (size_t i = 0; i < pointCount; ++i) {
+			const float time = m_translationTrack.GetPointTime(i);
+			if (m_rotationTrack.GetPointTime(i) != time || (fovPointCount != 0 && m_fovTrack.GetPointTime(i) != time)) {
+				return;
+			}
+		}
+
+		const bool isLoop = GetPlaybackMode() == PlaybackMode::kLoop;
+		const size_t segmentCount = isLoop ? pointCount + 1 : pointCount;
+		for (size_t index = 0; index < segmentCount; ++index) {
+			const size_t key = m_translationTrack.GetSegmentKey(index);
+			if (m_rotationTrack.GetSegmentKey(index) != key || (fovPointCount != 0 && m_fovTrack.GetSegmentKey(index) != key)) {
+				return;
+			}
+		}
+
+		SharedKeyBlock block;
+		block.m_times.resize(pointCount);
+		for (size_t i = 0; i < pointCount; ++i) {
+			block.m_times[i] = m_translationTrack.GetPointTime(i);
+		}
+		block.m_loopTimeOffset = GetLoopTimeOffset();
+		block.m_hasLoopSegment = isLoop && block.m_loopTimeOffset > 0.0f;
+
+		block.m_segments.resize(segmentCount);
+		for (size_t index = 0; index < segmentCount; ++index) {
+			SharedKeyBlock::Segment& segment = block.m_segments[index];
+			const size_t key = m_translationTrack.GetSegmentKey(index);
+			segment.m_easeIn = (key & TranslationPath::kEaseInFlag) != 0;
+			segment.m_easeOut = (key & TranslationPath::kEaseOutFlag) != 0;
+
+			TranslationPoint::SegmentCoefficients translation;
+			if (m_translationTrack.GetSegmentEvaluation(index, translation, segment.m_translation)) {
+				segment.m_polynomialMask |= SharedKeyBlock::kTranslationLanes;
+				for (size_t c = 0; c < translation.size(); ++c) {
+					segment.m_lanes.SetLane(c, translation[c]);
+				}
+			}
+			RotationPoint::SegmentCoefficients rotation;
+			if (m_rotationTrack.GetSegmentEvaluation(index, rotation, segment.m_rotation)) {
+				segment.m_polynomialMask |= SharedKeyBlock::kRotationLanes;
+				for (size_t c = 0; c < rotation.size(); ++c) {
+					segment.m_lanes.SetLane(3 + c, rotation[c]);
+				}
+			}
+			FOVPoint::SegmentCoefficients fov;
+			if (m_fovTrack.GetSegmentEvaluation(index, fov, segment.m_fov)) {
+				segment.m_polynomialMask |= SharedKeyBlock::kFOVLanes;
+				segment.m_lanes.SetLane(7, fov[0]);
+			}
+		}
+		m_sharedKeys = std::move(block);
+	}
+
+	void Timeline::SampleSharedKeys(float a_time, RE::NiPoint3& a_translation, RE::NiPoint3& a_rotation, float& a_fov) const
+	{
+		if (m_sharedKeys) {
+			m_sharedKeys->Evaluate(a_time, a_translation, a_rotation, a_fov);
+			return;
+		}
+		a_translation = m_translationTrack.GetPointAtTime(a_time);
+		a_rotation = m_rotationTrack.GetPointAtTime(a_time);
+		a_fov = m_fovTrack.GetPointAtTime(a_time);
 	}
 
 	void Timeline::ResetPlayback()
 	{
-		m_translationTrack.ResetTimeline();
-		m_rotationTrack.ResetTimeline();
-		m_fovTrack.ResetTimeline();
+		m_clock.Reset();
 	}
 
 	void Timeline::PausePlayback()
 	{
-		m_translationTrack.PausePlayback();
-		m_rotationTrack.PausePlayback();
-		m_fovTrack.PausePlayback();
+		m_clock.Pause();
 	}
 
 	void Timeline::ResumePlayback()
 	{
-		m_translationTrack.ResumePlayback();
-		m_rotationTrack.ResumePlayback();
-		m_fovTrack.ResumePlayback();
+		m_clock.Resume();
+	}
+
+	void Timeline::SetGlobalEasing(bool a_easeIn, bool a_easeOut)
+	{
+		m_clock.SetGlobalEasing(a_easeIn, a_easeOut);
 	}
 
 	RE::NiPoint3 Timeline::GetTranslation(float a_time) const
@@ -85,6 +423,244 @@ namespace FCFW
 		return m_fovTrack.GetPointAtTime(a_time);
 	}
 
+	bool Timeline::SampleBatch(std::span<const float> a_times, std::span<RE::NiPoint3> a_translations, std::span<RE::NiPoint3> a_rotations, std::span<float> a_fovs) const
+	{
+		const size_t count = a_times.size();
+		if ((!a_translations.empty() && a_translations.size() != count) ||
+			(!a_rotations.empty() && a_rotations.size() != count) ||
+			(!a_fovs.empty() && a_fovs.size() != count)) {
+			return false;
+		}
+
+		// Sort once and share the order between tracks; callers usually pass ascending times already
+		std::vector<size_t> order(count);
+		std::iota(order.begin(), order.end(), size_t{ 0 });
+		if (!std::is_sorted(a_times.begin(), a_times.end())) {
+			std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return a_times[a] < a_times[b]; });
+		}
+
+		if (!a_translations.empty()) {
+			m_translationTrack.SampleBatch(a_times, order, a_translations);
+		}
+		if (!a_rotations.empty()) {
+			m_rotationTrack.SampleBatch(a_times, order, a_rotations);
+		}
+		if (!a_fovs.empty()) {
+			m_fovTrack.SampleBatch(a_times, order, a_fovs);
+		}
+		return true;
+	}
+
+	bool Timeline::IsBakeable() const
+	{
+		if (m_translationTrack.GetPointCount() == 0 && m_rotationTrack.GetPointCount() == 0 && m_fovTrack.GetPointCount() == 0) {
+			return false;
+		}
+		// kReference and kCamera values are only known at runtime
+		for (PointType type : { PointType::kReference, PointType::kCamera }) {
+			if (m_translationTrack.HasPointType(type) || m_rotationTrack.HasPointType(type) || m_fovTrack.HasPointType(type)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::shared_ptr<const TimelineBake> Timeline::Bake(float a_sampleRate, float a_tolerance) const
+	{
+		if (a_sampleRate <= 0.0f || !IsBakeable()) {
+			return nullptr;
+		}
+
+		const float duration = std::max(GetDuration(), 0.0f);
+		const float minSpacing = 1.0f / a_sampleRate;
+		const size_t maxIntervals = std::max(static_cast<size_t>(std::ceil(duration / minSpacing)), size_t{ 1 });
+		if (maxIntervals >= kMaxBakeSamples) {
+			log::error("{}: {} samples per second over {}s exceeds the sample limit", __FUNCTION__, a_sampleRate, duration);
+			return nullptr;
+		}
+
+		auto evaluate = [this](float a_time) {
+			return BakeSample{ a_time, GetTranslation(a_time), GetRotation(a_time), GetFOV(a_time) };
+		};
+
+		std::vector<BakeSample> samples;
+		float cellWidth = minSpacing;
+		if (a_tolerance <= 0.0f) {
+			// Uniform: spacing of at most minSpacing that ends exactly on the duration
+			samples.reserve(maxIntervals + 1);
+			for (size_t i = 0; i <= maxIntervals; ++i) {
+				samples.push_back(evaluate(duration * static_cast<float>(i) / static_cast<float>(maxIntervals)));
+			}
+			cellWidth = duration / static_cast<float>(maxIntervals);
+		} else {
+			// Adaptive: seed with a coarse grid plus all key times, so corners at keys are never skipped
+			std::vector<float> seeds;
+			const float seedSpacing = minSpacing * kBakeSeedSpacingFactor;
+			for (float time = 0.0f; time < duration; time += seedSpacing) {
+				seeds.push_back(time);
+			}
+			for (size_t i = 0; i < m_translationTrack.GetPointCount(); ++i) {
+				seeds.push_back(m_translationTrack.GetPointTime(i));
+			}
+			for (size_t i = 0; i < m_rotationTrack.GetPointCount(); ++i) {
+				seeds.push_back(m_rotationTrack.GetPointTime(i));
+			}
+			for (size_t i = 0; i < m_fovTrack.GetPointCount(); ++i) {
+				seeds.push_back(m_fovTrack.GetPointTime(i));
+			}
+			std::sort(seeds.begin(), seeds.end());
+
+			// Keep every spacing >= minSpacing, which bounds the lookup walk to a single step
+			std::vector<float> spacedSeeds{ 0.0f };
+			for (float seed : seeds) {
+				if (seed - spacedSeeds.back() >= minSpacing && seed < duration) {
+					spacedSeeds.push_back(seed);
+				}
+			}
+			if (duration - spacedSeeds.back() < minSpacing && spacedSeeds.size() > 1) {
+				spacedSeeds.pop_back();
+			}
+			if (duration > 0.0f) {
+				spacedSeeds.push_back(duration);
+			}
+
+			// Split intervals at their midpoint until the quarter points are within tolerance
+			samples.push_back(evaluate(spacedSeeds.front()));
+			std::vector<BakeSample> pending;
+			for (size_t i = spacedSeeds.size() - 1; i > 0; --i) {
+				pending.push_back(evaluate(spacedSeeds[i]));
+			}
+			while (!pending.empty()) {
+				const BakeSample& from = samples.back();
+				const BakeSample& to = pending.back();
+				const float span = to.time - from.time;
+				if (span >= 2.0f * minSpacing) {
+					const BakeSample mid = evaluate(from.time + span * 0.5f);
+					const float error = std::max({
+						ReconstructionError(from, to, evaluate(from.time + span * 0.25f)),
+						ReconstructionError(from, to, mid),
+						ReconstructionError(from, to, evaluate(from.time + span * 0.75f))
+					});
+					if (error > a_tolerance) {
+						pending.push_back(mid);
+						continue;
+					}
+				}
+				samples.push_back(to);
+				pending.pop_back();
+			}
+		}
+
+		auto bake = std::make_shared<TimelineBake>();
+		bake->m_revision = m_revision;
+		bake->m_duration = duration;
+		bake->m_cellWidth = cellWidth;
+		bake->m_times.reserve(samples.size());
+		bake->m_translations.reserve(samples.size());
+		bake->m_rotations.reserve(samples.size());
+		bake->m_fovs.reserve(samples.size());
+		for (const BakeSample& sample : samples) {
+			bake->m_times.push_back(sample.time);
+			bake->m_translations.push_back(sample.translation);
+			bake->m_rotations.push_back(sample.rotation);
+			bake->m_fovs.push_back(sample.fov);
+		}
+
+		if (duration > 0.0f) {
+			const size_t cellCount = static_cast<size_t>(duration / cellWidth) + 1;
+			bake->m_cellStart.resize(cellCount);
+			std::uint32_t index = 0;
+			for (size_t cell = 0; cell < cellCount; ++cell) {
+				const float cellTime = static_cast<float>(cell) * cellWidth;
+				while (index + 1 < bake->m_times.size() && bake->m_times[index + 1] <= cellTime) {
+					++index;
+				}
+				bake->m_cellStart[cell] = index;
+			}
+		}
+		return bake;
+	}
+
+	bool Timeline::SetBake(std::shared_ptr<const TimelineBake> a_bake)
+	{
+		if (!a_bake || a_bake->m_revision != m_revision) {
+			return false;
+		}
+		m_bake = std::move(a_bake);
+		return true;
+	}
+
+	float Timeline::GetTranslationPathLength() const
+	{
+		return m_translationTrack.GetPathLength();
+	}
+
+	RE::NiPoint3 Timeline::GetTranslationAtConstantSpeed(float a_time) const
+	{
+		return m_translationTrack.GetPointAtTimeConstantSpeed(a_time);
+	}
+
+	bool Timeline::SupportsConstantSpeed() const
+	{
+		// The length table is built once, so it cannot follow moving references. It is built from
+		// segment polynomials, which channelized paths do not have.
+		return !m_translationTrack.HasPointType(PointType::kReference) && !m_translationTrack.IsChannelized();
+	}
+
+	bool Timeline::AutoRetimeByDistance()
+	{
+		const size_t pointCount = m_translationTrack.GetPointCount();
+		if (pointCount < 2 || !SupportsConstantSpeed()) {
+			return false;
+		}
+
+		std::vector<float> oldTimes(pointCount);
+		for (size_t i = 0; i < pointCount; ++i) {
+			oldTimes[i] = m_translationTrack.GetPointTime(i);
+		}
+
+		// Moving segments share their time in proportion to their length, holds (zero length) keep their duration
+		float totalLength = 0.0f;
+		float holdTime = 0.0f;
+		for (size_t i = 1; i < pointCount; ++i) {
+			const float length = m_translationTrack.GetSegmentLength(i);
+			totalLength += length;
+			if (length <= EPSILON_COMPARISON) {
+				holdTime += oldTimes[i] - oldTimes[i - 1];
+			}
+		}
+		if (totalLength <= EPSILON_COMPARISON) {
+			return false;
+		}
+
+		const float moveTime = (oldTimes.back() - oldTimes.front()) - holdTime;
+		std::vector<float> newTimes(pointCount);
+		newTimes[0] = oldTimes[0];
+		for (size_t i = 1; i < pointCount; ++i) {
+			const float length = m_translationTrack.GetSegmentLength(i);
+			const float duration = length <= EPSILON_COMPARISON ? oldTimes[i] - oldTimes[i - 1] : moveTime * length / totalLength;
+			newTimes[i] = newTimes[i - 1] + duration;
+		}
+		newTimes.back() = oldTimes.back();
+
+		// Warp all tracks with the same piecewise linear mapping, so rotation and FOV keys stay in sync with the path
+		auto remap = [&oldTimes, &newTimes](float a_time) {
+			if (a_time <= oldTimes.front() || a_time >= oldTimes.back()) {
+				return a_time;
+			}
+			const size_t next = static_cast<size_t>(std::distance(oldTimes.begin(), std::upper_bound(oldTimes.begin(), oldTimes.end(), a_time)));
+			const float fraction = (a_time - oldTimes[next - 1]) / (oldTimes[next] - oldTimes[next - 1]);
+			return newTimes[next - 1] + (newTimes[next] - newTimes[next - 1]) * fraction;
+		};
+
+		m_translationTrack.RemapPointTimes(remap);
+		m_rotationTrack.RemapPointTimes(remap);
+		m_fovTrack.RemapPointTimes(remap);
+		m_clock.Reset();
+		Invalidate();
+		return true;
+	}
+
 	size_t Timeline::GetTranslationPointCount() const
 	{
 		return m_translationTrack.GetPointCount();
@@ -102,47 +678,56 @@ namespace FCFW
 
 	float Timeline::GetDuration() const
 	{
-		return std::max({
-			m_translationTrack.GetDuration(),
-			m_rotationTrack.GetDuration(),
-			m_fovTrack.GetDuration()
-		});
+		return m_clock.GetDuration();
 	}
 
 	void Timeline::SetPlaybackMode(PlaybackMode a_mode)
 	{
+		if (a_mode == GetPlaybackMode()) {
+			return;
+		}
+		m_clock.SetPlaybackMode(a_mode);
 		m_translationTrack.SetPlaybackMode(a_mode);
 		m_rotationTrack.SetPlaybackMode(a_mode);
 		m_fovTrack.SetPlaybackMode(a_mode);
+		Invalidate();
 	}
 
 	void Timeline::SetLoopTimeOffset(float a_offset)
 	{
+		if (a_offset == GetLoopTimeOffset()) {
+			return;
+		}
+		m_clock.SetLoopTimeOffset(a_offset);
 		m_translationTrack.SetLoopTimeOffset(a_offset);
 		m_rotationTrack.SetLoopTimeOffset(a_offset);
 		m_fovTrack.SetLoopTimeOffset(a_offset);
+		Invalidate();
 	}
 
 	float Timeline::GetPlaybackTime() const
 	{
-		return m_translationTrack.GetPlaybackTime();
+		return m_clock.GetTime();
+	}
+
+	float Timeline::GetSampleTime() const
+	{
+		return m_clock.GetSampleTime();
 	}
 
 	void Timeline::SetPlaybackTime(float a_time)
 	{
-		m_translationTrack.SetPlaybackTime(a_time);
-		m_rotationTrack.SetPlaybackTime(a_time);
-		m_fovTrack.SetPlaybackTime(a_time);
+		m_clock.SetTime(a_time);
 	}
 
 	bool Timeline::IsPlaying() const
 	{
-		return m_translationTrack.IsPlaying() || m_rotationTrack.IsPlaying() || m_fovTrack.IsPlaying();
+		return m_clock.IsPlaying();
 	}
 
 	bool Timeline::IsPaused() const
 	{
-		return m_translationTrack.IsPaused() || m_rotationTrack.IsPaused() || m_fovTrack.IsPaused();
+		return m_clock.IsPaused();
 	}
 
 	void Timeline::ClearPoints()
@@ -150,6 +735,9 @@ namespace FCFW
 		m_translationTrack.ClearPoints();
 		m_rotationTrack.ClearPoints();
 		m_fovTrack.ClearPoints();
+		m_clock.SetPlaybackMode(PlaybackMode::kEnd);  // Tracks drop back to kEnd as well
+		m_clock.Reset();
+		Invalidate();
 	}
 
 	void Timeline::Reset()
@@ -161,12 +749,12 @@ namespace FCFW
 
 	PlaybackMode Timeline::GetPlaybackMode() const
 	{
-		return m_translationTrack.GetPlaybackMode();
+		return m_clock.GetPlaybackMode();
 	}
 
 	float Timeline::GetLoopTimeOffset() const
 	{
-		return m_translationTrack.GetLoopTimeOffset();
+		return m_clock.GetLoopTimeOffset();
 	}
 
 	TranslationPoint Timeline::GetTranslationPointAtCamera(float a_time, bool a_easeIn, bool a_easeOut) const
@@ -182,17 +770,26 @@ namespace FCFW
 	// YAML import/export wrappers
 	bool Timeline::AddTranslationPathFromFile(const std::string& a_filePath, float a_timeOffset)
 	{
-		return m_translationTrack.AddPathFromFile(a_filePath, a_timeOffset);
+		const bool result = m_translationTrack.AddPathFromFile(a_filePath, a_timeOffset);
+		m_clock.Reset();
+		Invalidate();
+		return result;
 	}
 
 	bool Timeline::AddRotationPathFromFile(const std::string& a_filePath, float a_timeOffset, float a_conversionFactor)
 	{
-		return m_rotationTrack.AddPathFromFile(a_filePath, a_timeOffset, a_conversionFactor);
+		const bool result = m_rotationTrack.AddPathFromFile(a_filePath, a_timeOffset, a_conversionFactor);
+		m_clock.Reset();
+		Invalidate();
+		return result;
 	}
 
 	bool Timeline::AddFOVPathFromFile(const std::string& a_filePath, float a_timeOffset)
 	{
-		return m_fovTrack.AddPathFromFile(a_filePath, a_timeOffset);
+		const bool result = m_fovTrack.AddPathFromFile(a_filePath, a_timeOffset);
+		m_clock.Reset();
+		Invalidate();
+		return result;
 	}
 
 	bool Timeline::ExportTranslationPath(std::ofstream& a_file) const
@@ -225,4 +822,19 @@ namespace FCFW
 		return m_fovTrack.GetPoint(a_index).m_point;
 	}
 
+	void Timeline::GetTranslationPoints(std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_positions) const
+	{
+		m_translationTrack.GetPoints(a_times, a_positions);
+	}
+
+	void Timeline::GetRotationPoints(std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_rotations) const
+	{
+		m_rotationTrack.GetPoints(a_times, a_rotations);
+	}
+
+	void Timeline::GetFOVPoints(std::vector<float>& a_times, std::vector<float>& a_fovs) const
+	{
+		m_fovTrack.GetPoints(a_times, a_fovs);
+	}
+
 }  // namespace FCFW
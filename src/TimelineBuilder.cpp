@@ -0,0 +1,86 @@
+#include "TimelineBuilder.h"
+#include "TimelineManager.h"
+
+namespace FCFW {
+    namespace {
+        // NaN times would break the ordering AddPoints sorts by, so a batch containing one is rejected as a whole
+        template <typename Key>
+        bool CheckKeys(const Key* a_keys, size_t a_count, const char* a_function) {
+            if (!a_keys && a_count > 0) {
+                log::error("{}: Null key array", a_function);
+                return false;
+            }
+            for (size_t i = 0; i < a_count; ++i) {
+                if (!std::isfinite(a_keys[i].time)) {
+                    log::error("{}: Key {} has a non-finite time", a_function, i);
+                    return false;
+                }
+            }
+            return true;
+        }
+    }
+
+    bool TimelineBuilder::AddTranslationKeys(const FCFW_API::TranslationKey* a_keys, size_t a_count) noexcept {
+        if (!CheckKeys(a_keys, a_count, __FUNCTION__)) {
+            return false;
+        }
+
+        m_translationPoints.reserve(m_translationPoints.size() + a_count);
+        for (size_t i = 0; i < a_count; ++i) {
+            const auto& key = a_keys[i];
+            Transition transition(key.time, static_cast<InterpolationMode>(key.interpolationMode), key.easeIn, key.easeOut);
+            m_translationPoints.emplace_back(transition, PointType::kWorld, key.position);
+        }
+        return true;
+    }
+
+    bool TimelineBuilder::AddRotationKeys(const FCFW_API::RotationKey* a_keys, size_t a_count) noexcept {
+        if (!CheckKeys(a_keys, a_count, __FUNCTION__)) {
+            return false;
+        }
+
+        m_rotationPoints.reserve(m_rotationPoints.size() + a_count);
+        for (size_t i = 0; i < a_count; ++i) {
+            const auto& key = a_keys[i];
+            Transition transition(key.time, static_cast<InterpolationMode>(key.interpolationMode), key.easeIn, key.easeOut);
+            m_rotationPoints.emplace_back(transition, PointType::kWorld, key.rotation);
+        }
+        return true;
+    }
+
+    bool TimelineBuilder::AddFOVKeys(const FCFW_API::FOVKey* a_keys, size_t a_count) noexcept {
+        if (!CheckKeys(a_keys, a_count, __FUNCTION__)) {
+            return false;
+        }
+
+        m_fovPoints.reserve(m_fovPoints.size() + a_count);
+        for (size_t i = 0; i < a_count; ++i) {
+            const auto& key = a_keys[i];
+            Transition transition(key.time, static_cast<InterpolationMode>(key.interpolationMode), key.easeIn, key.easeOut);
+            m_fovPoints.emplace_back(transition, key.fov);
+        }
+        return true;
+    }
+
+    void TimelineBuilder::Clear() noexcept {
+        m_translationPoints.clear();
+        m_rotationPoints.clear();
+        m_fovPoints.clear();
+    }
+
+    bool TimelineBuilder::Commit(size_t a_timelineID) noexcept {
+        // Sorting happens here, on the caller's thread; the swapped-out points are freed after the lock is released
+        TranslationTrack translationTrack;
+        RotationTrack rotationTrack;
+        FOVTrack fovTrack;
+        translationTrack.AddPoints(m_translationPoints);
+        rotationTrack.AddPoints(m_rotationPoints);
+        fovTrack.AddPoints(m_fovPoints);
+
+        return TimelineManager::GetSingleton().SwapTimelinePoints(m_pluginHandle, a_timelineID, translationTrack, rotationTrack, fovTrack);
+    }
+
+    void TimelineBuilder::Release() noexcept {
+        delete this;
+    }
+}
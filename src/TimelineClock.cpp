@@ -0,0 +1,99 @@
+#include "TimelineClock.h"
+#include "_ts_SKSEFunctions.h"
+
+namespace FCFW
+{
+	void TimelineClock::Update(float a_deltaTime)
+	{
+		if (m_isPaused || !m_isPlaying) {
+			return;
+		}
+
+		if (!m_hasPoints) {
+			m_isPlaying = false;
+			return;
+		}
+
+		m_time += a_deltaTime;
+
+		// Check for completion and handle based on playback mode
+		const float duration = GetDuration();
+		if (m_time >= duration) {
+			if (m_playbackMode == PlaybackMode::kLoop) {
+				// Loop: use modulo to wrap time seamlessly
+				m_time = duration > 0.0f ? std::fmod(m_time, duration) : 0.0f;
+			} else if (m_playbackMode == PlaybackMode::kWait) {
+				m_time = duration;
+			} else {
+				// End: clamp to final position and stop
+				m_time = duration;
+				m_isPlaying = false;
+			}
+		}
+	}
+
+	void TimelineClock::Start()
+	{
+		m_isPlaying = true;
+		m_isPaused = false;
+	}
+
+	void TimelineClock::ContinueFrom(const TimelineClock& a_previous)
+	{
+		m_time = a_previous.m_time;
+		m_isPlaying = a_previous.m_isPlaying;
+		m_isPaused = a_previous.m_isPaused;
+		m_globalEaseIn = a_previous.m_globalEaseIn;
+		m_globalEaseOut = a_previous.m_globalEaseOut;
+	}
+
+	void TimelineClock::Reset()
+	{
+		m_time = 0.0f;
+		m_isPlaying = false;
+		m_isPaused = false;
+	}
+
+	void TimelineClock::SetTime(float a_time)
+	{
+		m_time = std::clamp(a_time, 0.0f, GetDuration());
+	}
+
+	float TimelineClock::GetSampleTime() const
+	{
+		if (!m_globalEaseIn && !m_globalEaseOut) {
+			return m_time;
+		}
+
+		const float duration = GetDuration();
+		if (duration <= 0.0f) {
+			return m_time;
+		}
+		const float linearProgress = std::clamp(m_time / duration, 0.0f, 1.0f);
+		return _ts_SKSEFunctions::ApplyEasing(linearProgress, m_globalEaseIn, m_globalEaseOut) * duration;
+	}
+
+	float TimelineClock::GetDuration() const
+	{
+		if (!m_hasPoints) {
+			return 0.0f;
+		}
+		// In loop mode, add offset to create interpolation time from last to first point
+		if (m_playbackMode == PlaybackMode::kLoop) {
+			return m_lastPointTime + m_loopTimeOffset;
+		}
+		return m_lastPointTime;
+	}
+
+	void TimelineClock::SetKeyRange(bool a_hasPoints, float a_lastPointTime)
+	{
+		m_hasPoints = a_hasPoints;
+		m_lastPointTime = a_hasPoints ? a_lastPointTime : 0.0f;
+	}
+
+	void TimelineClock::SetGlobalEasing(bool a_easeIn, bool a_easeOut)
+	{
+		m_globalEaseIn = a_easeIn;
+		m_globalEaseOut = a_easeOut;
+	}
+}  // namespace FCFW
@@ -1,16 +1,141 @@
 #include "TimelineManager.h"
 #include "FCFW_Utils.h"
 #include <yaml-cpp/yaml.h>
+#include <thread>
 #include "APIManager.h"
 #include "Hooks.h"
+#include "ReferenceCache.h"
+#include "FrameCapture.h"
+#include "FrameProfiler.h"
+#include "TraceRecorder.h"
 namespace FCFW {
 
+    namespace {
+        // SKSE messages raised while the manager's locks are held are queued per thread and sent once the outermost
+        // API call has released them, so a listener can call straight back into the API (the locks are not recursive)
+        thread_local int t_deferredEventDepth = 0;
+        thread_local std::vector<std::pair<uint32_t, size_t>> t_deferredEvents;
+
+        void SendTimelineEvent(uint32_t a_messageType, size_t a_timelineID) {
+            auto* messaging = SKSE::GetMessagingInterface();
+            if (messaging) {
+                FCFW_API::FCFWTimelineEventData eventData{ a_timelineID };
+                messaging->Dispatch(a_messageType, &eventData, sizeof(eventData), nullptr);
+            }
+        }
+
+        // Declare before taking any lock in a function that can raise timeline events
+        class DeferredEvents {
+        public:
+            DeferredEvents() { ++t_deferredEventDepth; }
+            ~DeferredEvents() {
+                if (--t_deferredEventDepth > 0) {
+                    return;
+                }
+                auto events = std::move(t_deferredEvents);
+                t_deferredEvents.clear();
+                for (const auto& [messageType, timelineID] : events) {
+                    SendTimelineEvent(messageType, timelineID);
+                }
+            }
+            DeferredEvents(const DeferredEvents&) = delete;
+            DeferredEvents& operator=(const DeferredEvents&) = delete;
+        };
+    }
+
     void TimelineManager::ToggleBodyPartRotationMatrixDisplay(RE::Actor* a_actor, BodyPart a_bodyPart) {
-        m_displayRotationMatrix = !m_displayRotationMatrix;
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        m_displayRotationMatrix = !m_displayRotationMatrix.load();
         m_rotationMatrixActor = a_actor;
         m_rotationMatrixBodyPart = a_bodyPart;
     }
 
+    bool TimelineManager::StartFrameCapture(const char* a_filePath) {
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        
+        if (!a_filePath || !*a_filePath) {
+            return false;
+        }
+        return FrameCapture::GetSingleton().Arm(std::filesystem::current_path() / "Data" / a_filePath);
+    }
+
+    void TimelineManager::StopFrameCapture() {
+        std::lock_guard<std::mutex> lock(m_playbackMutex);
+        FrameCapture::GetSingleton().Disarm();
+    }
+
+    bool TimelineManager::StartTrace(const char* a_filePath) {
+        if (!a_filePath || !*a_filePath) {
+            return false;
+        }
+        return TraceRecorder::GetSingleton().Arm(std::filesystem::current_path() / "Data" / a_filePath);
+    }
+
+    bool TimelineManager::FlushTrace() {
+        return TraceRecorder::GetSingleton().Flush();
+    }
+
+    void TimelineManager::StopTrace() {
+        TraceRecorder::GetSingleton().Disarm();
+    }
+
+    uint64_t TimelineManager::QueueCommand(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command) {
+        const int type = static_cast<int>(a_command.type);
+        if (type < static_cast<int>(FCFW_API::CommandType::kAddTranslationPoint) || type > static_cast<int>(FCFW_API::CommandType::kResumePlayback)) {
+            log::error("{}: Invalid command type {}", __FUNCTION__, type);
+            return 0;
+        }
+        
+        const uint64_t ticket = m_commandQueue.Submit(a_pluginHandle, a_command);
+        if (ticket == 0) {
+            log::warn("{}: Command queue is full, dropping command {} for timeline {}", __FUNCTION__, type, a_command.timelineID);
+        }
+        return ticket;
+    }
+
+    FCFW_API::CommandStatus TimelineManager::GetCommandResult(uint64_t a_ticket, int* a_result) const {
+        return m_commandQueue.GetResult(a_ticket, a_result);
+    }
+
+    FCFW_API::CommandStatus TimelineManager::WaitForCommand(uint64_t a_ticket, int* a_result, uint32_t a_timeoutMs) const {
+        return m_commandQueue.Wait(a_ticket, a_result, std::chrono::milliseconds(a_timeoutMs));
+    }
+
+    int TimelineManager::ApplyCommand(SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command) {
+        const size_t timelineID = a_command.timelineID;
+        const auto interpolationMode = static_cast<InterpolationMode>(a_command.interpolationMode);
+        switch (a_command.type) {
+        case FCFW_API::CommandType::kAddTranslationPoint:
+            return AddTranslationPoint(a_pluginHandle, timelineID, a_command.time, a_command.value, a_command.easeIn, a_command.easeOut, interpolationMode);
+        case FCFW_API::CommandType::kAddRotationPoint:
+            return AddRotationPoint(a_pluginHandle, timelineID, a_command.time, a_command.value, a_command.easeIn, a_command.easeOut, interpolationMode);
+        case FCFW_API::CommandType::kAddFOVPoint:
+            return AddFOVPoint(a_pluginHandle, timelineID, a_command.time, a_command.value.x, a_command.easeIn, a_command.easeOut, interpolationMode);
+        case FCFW_API::CommandType::kRemoveTranslationPoint:
+            return RemoveTranslationPoint(a_pluginHandle, timelineID, a_command.index);
+        case FCFW_API::CommandType::kRemoveRotationPoint:
+            return RemoveRotationPoint(a_pluginHandle, timelineID, a_command.index);
+        case FCFW_API::CommandType::kRemoveFOVPoint:
+            return RemoveFOVPoint(a_pluginHandle, timelineID, a_command.index);
+        case FCFW_API::CommandType::kClearTimeline:
+            return ClearTimeline(a_pluginHandle, timelineID);
+        case FCFW_API::CommandType::kSetPlaybackMode:
+            return SetPlaybackMode(a_pluginHandle, timelineID, static_cast<PlaybackMode>(a_command.playbackMode), a_command.value.x);
+        case FCFW_API::CommandType::kAutoRetimeByDistance:
+            return AutoRetimeByDistance(a_pluginHandle, timelineID);
+        case FCFW_API::CommandType::kStartPlayback:
+            return StartPlayback(a_pluginHandle, timelineID, a_command.value.x, a_command.easeIn, a_command.easeOut, a_command.useDuration, a_command.duration, a_command.time, a_command.constantSpeed);
+        case FCFW_API::CommandType::kStopPlayback:
+            return StopPlayback(a_pluginHandle, timelineID);
+        case FCFW_API::CommandType::kPausePlayback:
+            return PausePlayback(a_pluginHandle, timelineID);
+        case FCFW_API::CommandType::kResumePlayback:
+            return ResumePlayback(a_pluginHandle, timelineID);
+        default:
+            return 0;
+        }
+    }
+
     void TimelineManager::UpdateBodyPartRotationMatrixDisplay() {
         if (!m_displayRotationMatrix || !m_rotationMatrixActor) {
             return;
@@ -54,15 +179,17 @@ namespace FCFW {
     }
 
     void TimelineManager::DispatchTimelineEvent(uint32_t a_messageType, size_t a_timelineID) {
-        auto* messaging = SKSE::GetMessagingInterface();
-        if (messaging) {
-            FCFW_API::FCFWTimelineEventData eventData{ a_timelineID };
-            messaging->Dispatch(a_messageType, &eventData, sizeof(eventData), nullptr);
+        if (t_deferredEventDepth > 0) {
+            t_deferredEvents.emplace_back(a_messageType, a_timelineID);
+            return;
         }
+        SendTimelineEvent(a_messageType, a_timelineID);
     }
 
     void TimelineManager::DispatchTimelineEventPapyrus(const char* a_eventName, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> lock(m_eventReceiversMutex);
+
+        TraceRecorder::Instant(a_eventName, a_timelineID);
         
         // Send event to all registered forms
         for (auto* receiver : m_eventReceivers) {
@@ -94,7 +221,7 @@ namespace FCFW {
     }
 
     void TimelineManager::RegisterForTimelineEvents(RE::TESForm* a_form) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> lock(m_eventReceiversMutex);
         
         if (!a_form) {
             return;
@@ -109,7 +236,7 @@ namespace FCFW {
     }
 
     void TimelineManager::UnregisterForTimelineEvents(RE::TESForm* a_form) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> lock(m_eventReceiversMutex);
         
         if (!a_form) {
             return;
@@ -123,9 +250,47 @@ namespace FCFW {
     }
 
     void TimelineManager::Update() {
-        // Hold lock for entire Update() to prevent race conditions
-        // This ensures the timeline cannot be deleted/modified while we're using it
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        auto& profiler = FrameProfiler::GetSingleton();
+        profiler.BeginFrame();
+        FrameProfiler::ScopedTimer updateTimer(FrameStage::kUpdate);
+
+        // Calls queued by other threads go first, in submission order, each taking its locks like a direct call
+        if (m_commandQueue.HasPending()) {
+            FrameProfiler::ScopedTimer commandsTimer(FrameStage::kCommands);
+            m_commandQueue.Drain([this](SKSE::PluginHandle a_pluginHandle, const FCFW_API::TimelineCommand& a_command) {
+                return ApplyCommand(a_pluginHandle, a_command);
+            });
+        }
+
+        // Nothing playing or recording: skip the lock (a save in progress always has an active timeline)
+        if (m_playbackState.Load().m_activeTimelineID == 0 && !m_displayRotationMatrix) {
+            return;
+        }
+
+        // Hold the playback lock and the active timeline's lock for the entire Update() to prevent race conditions
+        // This ensures the timeline cannot be deleted/modified while we're using it; other timelines stay available
+        DeferredEvents deferredEvents;
+        const auto lockWaitStart = FrameProfiler::IsEnabled() ? FrameProfiler::Clock::now() : FrameProfiler::Clock::time_point{};
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
+        std::shared_lock<std::shared_mutex> mapLock(m_timelinesMutex);
+        TimelineState* activeState = nullptr;
+        std::unique_lock<std::mutex> editLock;
+        std::unique_lock<std::shared_mutex> stateLock;
+        if (auto it = m_timelines.find(m_activeTimelineID); it != m_timelines.end()) {
+            activeState = &it->second;
+            // Playback only touches its own version, so the edit lock (and a version copy in progress, see PublishEdit)
+            // is only waited for by recording, which adds to m_timeline. m_isRecording only changes under m_playbackMutex.
+            if (activeState->m_isRecording) {
+                editLock = std::unique_lock<std::mutex>(activeState->m_editLock);
+            }
+            stateLock = std::unique_lock<std::shared_mutex>(activeState->m_lock);
+        }
+        if (FrameProfiler::IsEnabled()) {
+            profiler.Record(FrameStage::kLockWait, FrameProfiler::Clock::now() - lockWaitStart);
+        }
+
+        // Resolve each reference transform at most once for this tick, shared by all points and tracks
+        ReferenceCache::FrameScope referenceFrame;
         
         // for debug/testing: update body part rotation matrix display
         UpdateBodyPartRotationMatrixDisplay(); 
@@ -146,23 +311,31 @@ namespace FCFW {
         }
 
         // Check for active timeline
-        if (m_activeTimelineID == 0) {
-            return;
-        }
-        
-        auto it = m_timelines.find(m_activeTimelineID);
-        if (it == m_timelines.end()) {
+        if (!activeState) {
             return;
         }
-        TimelineState* activeState = &it->second;
  
         // Execute timeline operations under lock protection
-        PlayTimeline(activeState);
+        if (const PlaybackStep step = PlayTimeline(activeState); step != PlaybackStep::kContinue) {
+            // Ending playback hands the clock back to m_timeline: take the edit lock, in lock order. m_playbackMutex keeps
+            // the timeline active in between.
+            stateLock.unlock();
+            editLock = std::unique_lock<std::mutex>(activeState->m_editLock);
+            stateLock.lock();
+            if (step == PlaybackStep::kEnded) {
+                StopPlaybackLocked(activeState);
+            } else {
+                activeState->EndPlayingVersion();
+            }
+        }
         RecordTimeline(activeState);
+
+        // Playback or recording may have ended
+        PublishPlaybackState(m_activeTimelineID != 0 ? activeState : nullptr);
     }
 
     bool TimelineManager::StartRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_recordingInterval, bool a_append, float a_timeOffset) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
         
         // Check if any timeline is already active
         if (m_activeTimelineID != 0) {
@@ -170,7 +343,7 @@ namespace FCFW {
             return false;
         }
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -236,6 +409,7 @@ namespace FCFW {
         // Set as active timeline
         m_activeTimelineID = a_timelineID;
         state->m_isRecording = true;
+        PublishPlaybackState(state.m_state);
         state->m_currentRecordingTime = startTime;
         state->m_lastRecordedPointTime = startTime - state->m_recordingInterval;  // Ensure first point is captured immediately
 
@@ -261,9 +435,9 @@ namespace FCFW {
     }
 
     bool TimelineManager::StopRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -278,12 +452,17 @@ namespace FCFW {
             return false;
         }
         
-        auto* playerCamera = RE::PlayerCamera::GetSingleton();
-        if (!playerCamera) {
+        if (!RE::PlayerCamera::GetSingleton()) {
             return false;
         }
         
-        if (!(playerCamera->currentState && (playerCamera->currentState->id == RE::CameraState::kFree))) {
+        StopRecordingLocked(state.m_state);
+        return true;
+    }
+
+    void TimelineManager::StopRecordingLocked(TimelineState* a_state) {
+        auto* playerCamera = RE::PlayerCamera::GetSingleton();
+        if (!(playerCamera && playerCamera->currentState && (playerCamera->currentState->id == RE::CameraState::kFree))) {
             log::warn("{}: Not in free camera mode", __FUNCTION__);
         }
 
@@ -291,222 +470,265 @@ namespace FCFW {
         RE::NiPoint3 cameraRot = _ts_SKSEFunctions::GetCameraRotation();
         float fov = playerCamera ? playerCamera->worldFOV : 80.0f;
         
-        Transition transTranslation(state->m_currentRecordingTime, InterpolationMode::kCubicHermite, false, true);
+        Transition transTranslation(a_state->m_currentRecordingTime, InterpolationMode::kCubicHermite, false, true);
         TranslationPoint translationPoint(transTranslation, PointType::kWorld, cameraPos);
-        state->m_timeline.AddTranslationPoint(translationPoint);
+        a_state->m_timeline.AddTranslationPoint(translationPoint);
         
-        Transition transRotation(state->m_currentRecordingTime, InterpolationMode::kCubicHermite, false, true);
+        Transition transRotation(a_state->m_currentRecordingTime, InterpolationMode::kCubicHermite, false, true);
         float cameraRoll = Hooks::FreeCameraRollHook::GetFreeCameraRoll();
         RotationPoint rotationPoint(transRotation, PointType::kWorld, RE::NiPoint3{cameraRot.x, cameraRoll, cameraRot.z});
-        state->m_timeline.AddRotationPoint(rotationPoint);
+        a_state->m_timeline.AddRotationPoint(rotationPoint);
         
-        Transition transFOV(state->m_currentRecordingTime, InterpolationMode::kCubicHermite, false, true);
+        Transition transFOV(a_state->m_currentRecordingTime, InterpolationMode::kCubicHermite, false, true);
         FOVPoint fovPoint(transFOV, fov);
-        state->m_timeline.AddFOVPoint(fovPoint);
+        a_state->m_timeline.AddFOVPoint(fovPoint);
         
         ToggleFreeCameraNotHooked();
         
         // Clear recording state
         m_activeTimelineID = 0;
-        state->m_isRecording = false;
+        a_state->m_isRecording = false;
+        PublishPlaybackState(nullptr);
         
-        log::info("{}: Stopped recording on timeline {}", __FUNCTION__, a_timelineID);
-        return true;
+        log::info("{}: Stopped recording on timeline {}", __FUNCTION__, a_state->m_id);
+        FrameProfiler::GetSingleton().OnTimelineStop();
     }
 
     int TimelineManager::AddTranslationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
-        }
-        
         Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
         TranslationPoint point = state->m_timeline.GetTranslationPointAtCamera(a_time, a_easeIn, a_easeOut);
         point.m_transition = transition;
         
-        return static_cast<int>(state->m_timeline.AddTranslationPoint(point));
+        const size_t index = state->m_timeline.AddTranslationPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
     }
 
     int TimelineManager::AddTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_position, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
-        }
-        
         Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
         TranslationPoint point(transition, PointType::kWorld, a_position);
         
-        return static_cast<int>(state->m_timeline.AddTranslationPoint(point));
+        const size_t index = state->m_timeline.AddTranslationPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
     }
 
     int TimelineManager::AddTranslationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
-        if (!state) {
-            return -1;
-        }
-        
         if (!a_reference) {
             log::error("{}: Null reference provided", __FUNCTION__);
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return -1;
         }
         
         Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
         TranslationPoint point(transition, PointType::kReference, RE::NiPoint3{}, a_offset, a_reference, a_isOffsetRelative, a_bodyPart);
         
-        return static_cast<int>(state->m_timeline.AddTranslationPoint(point));
+        const size_t index = state->m_timeline.AddTranslationPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
     }
 
     int TimelineManager::AddRotationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
-        }
-        
         Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
         RotationPoint point = state->m_timeline.GetRotationPointAtCamera(a_time, a_easeIn, a_easeOut);
         point.m_transition = transition;
         
-        return static_cast<int>(state->m_timeline.AddRotationPoint(point));
+        const size_t index = state->m_timeline.AddRotationPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
     }
 
     int TimelineManager::AddRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_rotation, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
-        }
-        
         Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
         RotationPoint point(transition, PointType::kWorld, a_rotation);
         
-        return static_cast<int>(state->m_timeline.AddRotationPoint(point));
+        const size_t index = state->m_timeline.AddRotationPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
     }
 
     int TimelineManager::AddRotationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, BodyPart a_bodyPart, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
-        if (!state) {
-            return -1;
-        }
-        
         if (!a_reference) {
             log::error("{}: Null reference provided", __FUNCTION__);
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return -1;
         }
         
         Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
         RotationPoint point(transition, PointType::kReference, RE::NiPoint3{}, a_offset, a_reference, a_isOffsetRelative, a_bodyPart);
         
-        return static_cast<int>(state->m_timeline.AddRotationPoint(point));
+        const size_t index = state->m_timeline.AddRotationPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
     }
 
     int TimelineManager::AddFOVPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, float a_fov, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return -1;
+        }
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
+        FOVPoint point(transition, a_fov);
+        
+        const size_t index = state->m_timeline.AddFOVPoint(point);
+        PublishEdit(state);
+        return static_cast<int>(index);
+    }
+
+    int TimelineManager::AddTranslationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<const RE::NiPoint3> a_positions, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
+        if (a_times.empty() || a_times.size() != a_positions.size()) {
+            log::error("{}: Need one position per time ({} times, {} positions)", __FUNCTION__, a_times.size(), a_positions.size());
+            return -1;
+        }
+        
+        // Build the points before taking the timeline's lock
+        std::vector<TranslationPoint> points;
+        points.reserve(a_times.size());
+        for (size_t i = 0; i < a_times.size(); ++i) {
+            points.emplace_back(Transition(a_times[i], a_interpolationMode, a_easeIn, a_easeOut), PointType::kWorld, a_positions[i]);
+        }
+        
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+        const size_t count = state->m_timeline.AddTranslationPoints(points);
+        PublishEdit(state);
+        return static_cast<int>(count);
+    }
+
+    int TimelineManager::AddRotationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<const RE::NiPoint3> a_rotations, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
+        if (a_times.empty() || a_times.size() != a_rotations.size()) {
+            log::error("{}: Need one rotation per time ({} times, {} rotations)", __FUNCTION__, a_times.size(), a_rotations.size());
+            return -1;
         }
         
-        Transition transition(a_time, a_interpolationMode, a_easeIn, a_easeOut);
-        FOVPoint point(transition, a_fov);
+        std::vector<RotationPoint> points;
+        points.reserve(a_times.size());
+        for (size_t i = 0; i < a_times.size(); ++i) {
+            points.emplace_back(Transition(a_times[i], a_interpolationMode, a_easeIn, a_easeOut), PointType::kWorld, a_rotations[i]);
+        }
+        
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return -1;
+        }
         
-        return static_cast<int>(state->m_timeline.AddFOVPoint(point));
+        const size_t count = state->m_timeline.AddRotationPoints(points);
+        PublishEdit(state);
+        return static_cast<int>(count);
     }
 
-    bool TimelineManager::RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+    int TimelineManager::AddFOVPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<const float> a_fovs, bool a_easeIn, bool a_easeOut, InterpolationMode a_interpolationMode) {
+        if (a_times.empty() || a_times.size() != a_fovs.size()) {
+            log::error("{}: Need one FOV per time ({} times, {} FOVs)", __FUNCTION__, a_times.size(), a_fovs.size());
+            return -1;
+        }
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        std::vector<FOVPoint> points;
+        points.reserve(a_times.size());
+        for (size_t i = 0; i < a_times.size(); ++i) {
+            points.emplace_back(Transition(a_times[i], a_interpolationMode, a_easeIn, a_easeOut), a_fovs[i]);
+        }
+        
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return -1;
+        }
+        
+        const size_t count = state->m_timeline.AddFOVPoints(points);
+        PublishEdit(state);
+        return static_cast<int>(count);
+    }
+
+    bool TimelineManager::SwapTimelinePoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, TranslationTrack& a_translationTrack, RotationTrack& a_rotationTrack, FOVTrack& a_fovTrack) {
+        // A playing timeline continues on a version with the new points. Copy them for it before locking, so the locks are
+        // only held for the swap; if playback starts in between, PublishEdit copies m_timeline instead.
+        std::optional<std::tuple<TranslationTrack, RotationTrack, FOVTrack>> versionTracks;
+        if (const auto playback = m_playbackState.Load(); playback.m_activeTimelineID == a_timelineID && playback.m_isPlaybackRunning) {
+            versionTracks.emplace(a_translationTrack, a_rotationTrack, a_fovTrack);
+        }
+        
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+        if (state->m_isRecording) {
+            log::error("{}: Timeline {} is recording", __FUNCTION__, a_timelineID);
+            return false;
         }
         
-        state->m_timeline.RemoveTranslationPoint(a_index);
+        state->m_timeline.SwapPoints(a_translationTrack, a_rotationTrack, a_fovTrack);
+        std::shared_ptr<Timeline> version;
+        if (state->m_isPlaybackRunning && versionTracks) {
+            auto& [translationTrack, rotationTrack, fovTrack] = *versionTracks;
+            version = state->m_timeline.CopyWithPoints(std::move(translationTrack), std::move(rotationTrack), std::move(fovTrack));
+        }
+        PublishEdit(state, std::move(version));
         return true;
     }
 
-    bool TimelineManager::RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+    bool TimelineManager::RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) {
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+        state->m_timeline.RemoveTranslationPoint(a_index);
+        PublishEdit(state);
+        return true;
+    }
+
+    bool TimelineManager::RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) {
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return false;
         }
         
         state->m_timeline.RemoveRotationPoint(a_index);
+        PublishEdit(state);
         return true;
     }
 
     bool TimelineManager::RemoveFOVPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
         
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
-        }
-        
         state->m_timeline.RemoveFOVPoint(a_index);
+        PublishEdit(state);
         return true;
     }
 
@@ -647,15 +869,32 @@ namespace FCFW {
     }
 
 
-    void TimelineManager::PlayTimeline(TimelineState* a_state) {
+    TimelineManager::PlaybackStep TimelineManager::PlayTimeline(TimelineState* a_state) {
         if (!a_state || !a_state->m_isPlaybackRunning) {
-            return;
+            return PlaybackStep::kContinue;
+        }
+        TraceRecorder::Scope traceScope("PlayTimeline", a_state->m_id);
+        
+        // Frame boundary: switch to the latest version published by an edit, continuing at the current playback time.
+        // The replaced version is freed by the next publish, not by the frame.
+        if (auto next = a_state->m_publishedTimeline.Take()) {
+            if (next->GetRevision() > a_state->m_playingTimeline->GetRevision()) {
+                next->ContinuePlayback(*a_state->m_playingTimeline);
+                std::swap(a_state->m_playingTimeline, next);
+                TraceRecorder::Instant("AdoptTimelineVersion", a_state->m_id);
+                FrameCapture::GetSingleton().EndSession();  // A capture covers one timeline version
+                if (a_state->m_constantSpeed && !a_state->m_playingTimeline->SupportsConstantSpeed()) {
+                    log::warn("{}: Timeline {} no longer supports constant speed, continuing at normal speed", __FUNCTION__, a_state->m_id);
+                    a_state->m_constantSpeed = false;
+                }
+            }
+            a_state->m_publishedTimeline.Retire(std::move(next));
         }
+        Timeline& timeline = *a_state->m_playingTimeline;
         
-        if (a_state->m_timeline.GetTranslationPointCount() == 0 && a_state->m_timeline.GetRotationPointCount() == 0) {
-            m_activeTimelineID = 0;
-            a_state->m_isPlaybackRunning = false;
-            return;
+        if (timeline.GetTranslationPointCount() == 0 && timeline.GetRotationPointCount() == 0) {
+            log::info("{}: Timeline {} has no points left, stopping playback", __FUNCTION__, a_state->m_id);
+            return PlaybackStep::kEnded;
         }
         
         auto* playerCamera = RE::PlayerCamera::GetSingleton();
@@ -663,13 +902,13 @@ namespace FCFW {
             log::error("{}: PlayerCamera not found during playback", __FUNCTION__);
             m_activeTimelineID = 0;
             a_state->m_isPlaybackRunning = false;
-            return;
+            return PlaybackStep::kAborted;
         }
         
         if (!playerCamera->IsInFreeCameraMode()) {
             m_activeTimelineID = 0;
             a_state->m_isPlaybackRunning = false;
-            return;
+            return PlaybackStep::kAborted;
         }
         
         RE::FreeCameraState* cameraState = nullptr;
@@ -681,57 +920,58 @@ namespace FCFW {
             log::error("{}: FreeCameraState not found during playback", __FUNCTION__);
             m_activeTimelineID = 0;
             a_state->m_isPlaybackRunning = false;
-            return;
+            return PlaybackStep::kAborted;
         }
 
         // Update UI visibility
         auto* ui = RE::UI::GetSingleton();        
         if (ui && ui->GameIsPaused()) {
+            FrameProfiler::ScopedTimer showMenusTimer(FrameStage::kShowMenus);
             ui->ShowMenus(m_isShowingMenus);
-            return;
+            return PlaybackStep::kContinue;
         }        
-        ui->ShowMenus(a_state->m_showMenusDuringPlayback);
-
-        float deltaTime = _ts_SKSEFunctions::GetRealTimeDeltaTime() * a_state->m_playbackSpeed;
-        a_state->m_timeline.UpdatePlayback(deltaTime);
-
-        // Apply global easing
-        float sampleTime = a_state->m_timeline.GetPlaybackTime();
-        if (a_state->m_globalEaseIn || a_state->m_globalEaseOut) {
-            float timelineDuration = a_state->m_timeline.GetDuration();
-            
-            if (timelineDuration > 0.0f) {
-                float linearProgress = std::clamp(sampleTime / timelineDuration, 0.0f, 1.0f);
-                float easedProgress = _ts_SKSEFunctions::ApplyEasing(linearProgress, a_state->m_globalEaseIn, a_state->m_globalEaseOut);
-                sampleTime = easedProgress * timelineDuration;
-            }
-        }
-        
-        // Get interpolated points
-        RE::NiPoint3 cameraPos = a_state->m_timeline.GetTranslation(sampleTime);
+        {
+            FrameProfiler::ScopedTimer showMenusTimer(FrameStage::kShowMenus);
+            ui->ShowMenus(a_state->m_showMenusDuringPlayback);
+        }
+
+        // Advance and sample the timeline (game-independent, see PlaybackFrame.h); an armed frame capture records the
+        // frame's game inputs and its result
+        auto& capture = FrameCapture::GetSingleton();
+        const float realDeltaTime = _ts_SKSEFunctions::GetRealTimeDeltaTime();
+        capture.BeginFrame(realDeltaTime);
+        const PlaybackFrameSettings settings{ a_state->m_playbackSpeed, a_state->m_constantSpeed, a_state->m_followGround, a_state->m_minHeightAboveGround };
+        PlaybackFrame frame;
+        {
+            FrameProfiler::ScopedTimer sampleTimer(FrameStage::kSample);
+            frame = AdvancePlayback(timeline, settings, realDeltaTime, [&capture](const RE::NiPoint3& a_position) {
+                FrameProfiler::ScopedTimer groundHeightTimer(FrameStage::kGroundHeight);
+                const float landHeight = _ts_SKSEFunctions::GetLandHeightWithWater(a_position, false);
+                capture.RecordLandHeight(a_position, landHeight);
+                return landHeight;
+            });
+        }
+        capture.EndFrame(frame);
         
         // Apply FOV if timeline has FOV points
-        if (a_state->m_timeline.GetFOVPointCount() > 0) {
-            playerCamera->worldFOV = a_state->m_timeline.GetFOV(sampleTime);
-        }
-
-        // Apply ground-following if enabled
-        if (a_state->m_followGround) {
-            float landHeight = _ts_SKSEFunctions::GetLandHeightWithWater(cameraPos, false);
-            float cameraHeight = cameraPos.z - landHeight;
-            if (cameraHeight < a_state->m_minHeightAboveGround) {
-                cameraPos.z = landHeight + a_state->m_minHeightAboveGround;
-            }
+        if (frame.m_hasFOV) {
+            playerCamera->worldFOV = frame.m_fov;
         }
         
-        cameraState->translation = cameraPos;
+        cameraState->translation = frame.m_position;
 
-        PropagatePlayerIfNeeded();
+        {
+            FrameProfiler::ScopedTimer propagateTimer(FrameStage::kPropagatePlayer);
+            PropagatePlayerIfNeeded();
+        }
 
         // re-center audio to current camera position
-        CorrectAudioListener();
+        {
+            FrameProfiler::ScopedTimer audioTimer(FrameStage::kAudioListener);
+            CorrectAudioListener();
+        }
         
-        RE::NiPoint3 rotation = a_state->m_timeline.GetRotation(sampleTime);
+        const RE::NiPoint3& rotation = frame.m_rotation;
         
         // Handle user rotation
         if (m_userTurning && a_state->m_allowUserRotation) {
@@ -747,26 +987,25 @@ namespace FCFW {
         float roll = rotation.y;
         Hooks::FreeCameraRollHook::SetFreeCameraRoll(roll);
         
-        if (a_state->m_timeline.GetPlaybackMode() == PlaybackMode::kWait) {
-            float playbackTime = a_state->m_timeline.GetPlaybackTime();
-            float timelineDuration = a_state->m_timeline.GetDuration();
+        if (timeline.GetPlaybackMode() == PlaybackMode::kWait) {
+            float playbackTime = timeline.GetPlaybackTime();
+            float timelineDuration = timeline.GetDuration();
             if ((playbackTime >= timelineDuration) && !a_state->m_isCompletedAndWaiting) {
                 DispatchTimelineEvent(static_cast<uint32_t>(FCFW_API::FCFWMessage::kPlaybackWait), a_state->m_id);
                 DispatchTimelineEventPapyrus("OnPlaybackWait", a_state->m_id);
                 a_state->m_isCompletedAndWaiting = true;
             }
             // Keep playback running - user must manually call StopPlayback
-        } else if (!a_state->m_timeline.IsPlaying()) {
-            size_t timelineID = a_state->m_id;
-            SKSE::PluginHandle ownerHandle = a_state->m_ownerHandle;
-            StopPlayback(ownerHandle, timelineID);
+        } else if (!timeline.IsPlaying()) {
+            return PlaybackStep::kEnded;
         }
+        return PlaybackStep::kContinue;
     }
 
     bool TimelineManager::ClearTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        DeferredEvents deferredEvents;
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);  // A cleared timeline has nothing left to play
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -776,17 +1015,17 @@ namespace FCFW {
         }
         
         if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+            log::info("{}: Timeline {} cleared during playback, stopping playback", __FUNCTION__, a_timelineID);
+            StopPlaybackLocked(state.m_state);
         }
-        
         state->Reset();
         
         return true;
     }
 
-    bool TimelineManager::StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, float a_startTime) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+    bool TimelineManager::StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, float a_startTime, bool a_constantSpeed) {
+        DeferredEvents deferredEvents;
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
         
         // Check if any timeline is already active
         if (m_activeTimelineID != 0) {
@@ -794,7 +1033,7 @@ namespace FCFW {
             return false;
         }
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -805,6 +1044,11 @@ namespace FCFW {
             return false;
         }
         
+        if (a_constantSpeed && !state->m_timeline.SupportsConstantSpeed()) {
+            log::error("{}: Timeline {} has reference translation points, constant speed playback is not supported", __FUNCTION__, a_timelineID);
+            return false;
+        }
+        
         auto* playerCamera = RE::PlayerCamera::GetSingleton();
         if (!playerCamera) {
             log::error("{}: PlayerCamera not available", __FUNCTION__);
@@ -851,10 +1095,12 @@ namespace FCFW {
         // Set playback parameters
         state->m_globalEaseIn = a_globalEaseIn;
         state->m_globalEaseOut = a_globalEaseOut;
+        state->m_constantSpeed = a_constantSpeed;
         
         // Set as active timeline
         m_activeTimelineID = a_timelineID;
         state->m_isPlaybackRunning = true;
+        PublishPlaybackState(state.m_state);
         state->m_rotationOffset = RE::NiPoint3{ 0.0f, 0.0f, 0.0f };  // Reset per-timeline rotation offset
         state->m_isCompletedAndWaiting = false;   // Reset completion event flag for kWait mode
         
@@ -875,6 +1121,7 @@ namespace FCFW {
         
         // Initialize timeline playback
         state->m_timeline.ResetPlayback();
+        state->m_timeline.SetGlobalEasing(state->m_globalEaseIn, state->m_globalEaseOut);
         state->m_timeline.StartPlayback();
         
         // Set start time if specified (for save/load resume)
@@ -886,6 +1133,23 @@ namespace FCFW {
             }
             state->m_timeline.SetPlaybackTime(clampedTime);
         }
+        state->BeginPlayingVersion();
+        
+        // Debug/testing: an armed frame capture records this playback, with a copy of the timeline next to it
+        auto& capture = FrameCapture::GetSingleton();
+        if (capture.IsArmed() && !capture.IsInSession()) {
+            CapturedSession session;
+            session.m_settings = PlaybackFrameSettings{ state->m_playbackSpeed, state->m_constantSpeed, state->m_followGround, state->m_minHeightAboveGround };
+            session.m_globalEaseIn = state->m_globalEaseIn;
+            session.m_globalEaseOut = state->m_globalEaseOut;
+            session.m_startTime = state->m_timeline.GetPlaybackTime();
+            session.m_cameraPosition = _ts_SKSEFunctions::GetCameraPos();
+            const RE::NiPoint3 cameraRotation = _ts_SKSEFunctions::GetCameraRotation();
+            session.m_cameraRotation = RE::NiPoint3{ cameraRotation.x, Hooks::FreeCameraRollHook::GetFreeCameraRoll(), cameraRotation.z };
+            session.m_cameraFOV = playerCamera->worldFOV;
+            capture.BeginSession(session);
+            WriteTimelineFile(state.m_state, FrameCapture::GetTimelineFilePath(capture.GetFilePath()));
+        }
         
         // Handle UI visibility
         auto* ui = RE::UI::GetSingleton();
@@ -929,9 +1193,7 @@ namespace FCFW {
     }
 
     int TimelineManager::GetTranslationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
@@ -940,9 +1202,7 @@ namespace FCFW {
     }
 
     int TimelineManager::GetRotationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
@@ -951,9 +1211,7 @@ namespace FCFW {
     }
 
     int TimelineManager::GetFOVPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1;
         }
@@ -964,9 +1222,10 @@ namespace FCFW {
     
 
     bool TimelineManager::StopPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        DeferredEvents deferredEvents;
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -981,6 +1240,13 @@ namespace FCFW {
             return false;
         }
         
+        StopPlaybackLocked(state.m_state);
+        return true;
+    }
+
+    void TimelineManager::StopPlaybackLocked(TimelineState* a_state) {
+        const size_t timelineID = a_state->m_id;
+        
         auto* playerCamera = RE::PlayerCamera::GetSingleton();
         if (playerCamera && playerCamera->IsInFreeCameraMode()) {
             PropagatePlayerIfNeeded(true);
@@ -1003,7 +1269,7 @@ namespace FCFW {
             }
             
             // Restore FOV to pre-playback value
-            playerCamera->worldFOV = state->m_savedFOV;
+            playerCamera->worldFOV = a_state->m_savedFOV;
 
             // Reset camera roll
             Hooks::FreeCameraRollHook::SetFreeCameraRoll(0.0f);
@@ -1011,19 +1277,26 @@ namespace FCFW {
         
         // Clear active state
         m_activeTimelineID = 0;
-        state->m_isPlaybackRunning = false;
+        a_state->m_isPlaybackRunning = false;
+        a_state->EndPlayingVersion();
+        PublishPlaybackState(nullptr);
+        FrameCapture::GetSingleton().EndSession();
         
-        log::info("{}: Stopped playback on timeline {}", __FUNCTION__, a_timelineID);
+        log::info("{}: Stopped playback on timeline {}", __FUNCTION__, timelineID);
+        FrameProfiler::GetSingleton().OnTimelineStop();
         
         // Dispatch playback stopped event
-        DispatchTimelineEvent(static_cast<uint32_t>(FCFW_API::FCFWMessage::kPlaybackStop), a_timelineID);
-        DispatchTimelineEventPapyrus("OnPlaybackStop", a_timelineID);
-        
-        return true;
+        DispatchTimelineEvent(static_cast<uint32_t>(FCFW_API::FCFWMessage::kPlaybackStop), timelineID);
+        DispatchTimelineEventPapyrus("OnPlaybackStop", timelineID);
+
+        // Write the trace of this playback, stop event included
+        TraceRecorder::GetSingleton().Flush();
     }
 
     bool TimelineManager::SwitchPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        DeferredEvents deferredEvents;
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
+        std::shared_lock<std::shared_mutex> mapLock(m_timelinesMutex);
         
         // Validate target timeline exists and is owned by caller
         TimelineState* toState = GetTimeline(a_toTimelineID, a_pluginHandle);
@@ -1036,18 +1309,11 @@ namespace FCFW {
         TimelineState* fromState = nullptr;
         
         if (a_fromTimelineID == 0) {
-            // Switch from any timeline owned by this plugin that is currently playing
-            for (auto& [id, state] : m_timelines) {
-                if (state.m_ownerHandle == a_pluginHandle && state.m_isPlaybackRunning && m_activeTimelineID == id) {
-                    fromState = &state;
-                    a_fromTimelineID = id;  // Store for logging
-                    break;
-                }
-            }
-            
-            if (!fromState) {
-                log::warn("{}: No active timeline found for plugin handle {}", __FUNCTION__, a_pluginHandle);
-                return false;
+            // Switch from the active timeline if this plugin owns it
+            auto it = m_timelines.find(m_activeTimelineID);
+            if (it != m_timelines.end() && it->second.m_ownerHandle == a_pluginHandle) {
+                fromState = &it->second;
+                a_fromTimelineID = m_activeTimelineID;  // Store for logging
             }
         } else {
             fromState = GetTimeline(a_fromTimelineID, a_pluginHandle);
@@ -1055,12 +1321,30 @@ namespace FCFW {
                 log::warn("{}: Source timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_fromTimelineID, a_pluginHandle);
                 return false;
             }
-            
-            // Verify source timeline is actively playing
-            if (!fromState->m_isPlaybackRunning || m_activeTimelineID != a_fromTimelineID) {
+        }
+        
+        // The only place holding the locks of two timelines; m_playbackMutex serializes it, so the order between them is free
+        std::unique_lock<std::mutex> fromEditLock;
+        std::unique_lock<std::shared_mutex> fromLock;
+        if (fromState) {
+            fromEditLock = std::unique_lock<std::mutex>(fromState->m_editLock);
+            fromLock = std::unique_lock<std::shared_mutex>(fromState->m_lock);
+        }
+        std::unique_lock<std::mutex> toEditLock;
+        std::unique_lock<std::shared_mutex> toLock;
+        if (toState != fromState) {
+            toEditLock = std::unique_lock<std::mutex>(toState->m_editLock);
+            toLock = std::unique_lock<std::shared_mutex>(toState->m_lock);
+        }
+        
+        // Verify source timeline is actively playing
+        if (!fromState || !fromState->m_isPlaybackRunning || m_activeTimelineID != a_fromTimelineID) {
+            if (a_fromTimelineID == 0) {
+                log::warn("{}: No active timeline found for plugin handle {}", __FUNCTION__, a_pluginHandle);
+            } else {
                 log::warn("{}: Source timeline {} is not actively playing", __FUNCTION__, a_fromTimelineID);
-                return false;
             }
+            return false;
         }
         
         // Validate target timeline has points
@@ -1078,10 +1362,13 @@ namespace FCFW {
         
         log::info("{}: Switching playback from timeline {} to timeline {}", 
                   __FUNCTION__, a_fromTimelineID, a_toTimelineID);
+        TraceRecorder::Instant("SwitchPlayback", a_toTimelineID);
         
         // Stop source timeline WITHOUT exiting free camera mode
         fromState->m_isPlaybackRunning = false;
+        fromState->EndPlayingVersion();
         m_activeTimelineID = 0;  // Temporarily clear to allow new timeline activation
+        FrameCapture::GetSingleton().EndSession();  // A capture covers one timeline
         
         // Dispatch stop event for source timeline
         DispatchTimelineEvent(static_cast<uint32_t>(FCFW_API::FCFWMessage::kPlaybackStop), a_fromTimelineID);
@@ -1093,11 +1380,13 @@ namespace FCFW {
         
         // Copy all runtime playback state from source to target timeline
         CopyPlaybackState(fromState, toState);
+        toState->BeginPlayingVersion();
         
         // Activate target timeline (camera stays in free mode)
         m_activeTimelineID = a_toTimelineID;
         toState->m_isPlaybackRunning = true;
         toState->m_isCompletedAndWaiting = false;
+        PublishPlaybackState(toState);
         
         // Dispatch start event for target timeline
         DispatchTimelineEvent(static_cast<uint32_t>(FCFW_API::FCFWMessage::kPlaybackStart), a_toTimelineID);
@@ -1115,8 +1404,10 @@ namespace FCFW {
         a_toState->m_showMenusDuringPlayback = a_fromState->m_showMenusDuringPlayback;
         a_toState->m_globalEaseIn = a_fromState->m_globalEaseIn;
         a_toState->m_globalEaseOut = a_fromState->m_globalEaseOut;
+        a_toState->m_timeline.SetGlobalEasing(a_toState->m_globalEaseIn, a_toState->m_globalEaseOut);
         a_toState->m_followGround = a_fromState->m_followGround;
         a_toState->m_minHeightAboveGround = a_fromState->m_minHeightAboveGround;
+        a_toState->m_constantSpeed = a_fromState->m_constantSpeed && a_toState->m_timeline.SupportsConstantSpeed();
         
         // Only preserve rotation offset if target timeline allows user rotation
         // If target doesn't allow user rotation, reset to zero so timeline plays its intended rotation
@@ -1128,9 +1419,7 @@ namespace FCFW {
     }
 
     bool TimelineManager::PausePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1139,14 +1428,12 @@ namespace FCFW {
             return false;
         }
         
-        state->m_timeline.PausePlayback();
+        state->GetPlaybackTimeline().PausePlayback();
         return true;
     }
 
     bool TimelineManager::ResumePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1155,14 +1442,12 @@ namespace FCFW {
             return false;
         }
         
-        state->m_timeline.ResumePlayback();
+        state->GetPlaybackTimeline().ResumePlayback();
         return true;
     }
 
     bool TimelineManager::IsPlaybackRunning(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1171,21 +1456,16 @@ namespace FCFW {
     }
 
     float TimelineManager::GetPlaybackTime(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1.0f;
         }
         
-        return state->m_timeline.GetPlaybackTime();
+        return state->GetPlaybackTimeline().GetPlaybackTime();
     }
 
     bool TimelineManager::IsRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1194,20 +1474,16 @@ namespace FCFW {
     }
 
     bool TimelineManager::IsPlaybackPaused(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
         
-        return state->m_timeline.IsPaused();
+        return state->GetPlaybackTimeline().IsPaused();
     }
 
     RE::NiPoint3 TimelineManager::GetTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
             return RE::NiPoint3(0.0f, 0.0f, 0.0f);
@@ -1222,9 +1498,7 @@ namespace FCFW {
     }
 
     RE::NiPoint3 TimelineManager::GetRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
             return RE::NiPoint3{0.0f, 0.0f, 0.0f};
@@ -1239,9 +1513,7 @@ namespace FCFW {
     }
 
     float TimelineManager::GetFOVPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
             return 80.0f;
@@ -1255,22 +1527,160 @@ namespace FCFW {
         return state->m_timeline.GetFOVPoint(a_index);
     }
 
+    bool TimelineManager::GetTranslationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_positions) const {
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
+            return false;
+        }
+        
+        state->m_timeline.GetTranslationPoints(a_times, a_positions);
+        return true;
+    }
+
+    bool TimelineManager::GetRotationPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::vector<float>& a_times, std::vector<RE::NiPoint3>& a_rotations) const {
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
+            return false;
+        }
+        
+        state->m_timeline.GetRotationPoints(a_times, a_rotations);
+        return true;
+    }
+
+    bool TimelineManager::GetFOVPoints(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::vector<float>& a_times, std::vector<float>& a_fovs) const {
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
+            return false;
+        }
+        
+        state->m_timeline.GetFOVPoints(a_times, a_fovs);
+        return true;
+    }
+
+    bool TimelineManager::SampleTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, std::span<const float> a_times, std::span<RE::NiPoint3> a_translations, std::span<RE::NiPoint3> a_rotations, std::span<float> a_fovs) const {
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            log::error("{}: Timeline {} not found or not owned by plugin handle {}", __FUNCTION__, a_timelineID, a_pluginHandle);
+            return false;
+        }
+        
+        if (!state->m_timeline.SampleBatch(a_times, a_translations, a_rotations, a_fovs)) {
+            log::error("{}: Output buffers must be empty or hold one entry per sample time ({})", __FUNCTION__, a_times.size());
+            return false;
+        }
+        
+        return true;
+    }
+
+    float TimelineManager::GetTranslationPathLength(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return 0.0f;
+        }
+        
+        return state->m_timeline.GetTranslationPathLength();
+    }
+
+    bool TimelineManager::AutoRetimeByDistance(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return false;
+        }
+        
+        if (state->m_isRecording) {
+            log::error("{}: Timeline {} is recording", __FUNCTION__, a_timelineID);
+            return false;
+        }
+        
+        if (!state->m_timeline.AutoRetimeByDistance()) {
+            log::error("{}: Timeline {} needs at least two translation points without references and a non-zero path length", __FUNCTION__, a_timelineID);
+            return false;
+        }
+        
+        PublishEdit(state);
+        return true;
+    }
+
+    bool TimelineManager::BakeTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_sampleRate, float a_tolerance) {
+        auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return false;
+        }
+        
+        if (a_sampleRate <= 0.0f) {
+            log::error("{}: Invalid sample rate {}", __FUNCTION__, a_sampleRate);
+            return false;
+        }
+        
+        if (state->m_isRecording) {
+            log::error("{}: Timeline {} is recording", __FUNCTION__, a_timelineID);
+            return false;
+        }
+        
+        if (!state->m_timeline.IsBakeable()) {
+            log::error("{}: Timeline {} is empty or has reference/camera points, which can only be evaluated at runtime", __FUNCTION__, a_timelineID);
+            return false;
+        }
+        
+        // Bake a snapshot on a worker thread. The result is only swapped in if the timeline
+        // still has the snapshot's revision, i.e. was not edited in the meantime.
+        std::thread([this, a_timelineID, a_sampleRate, a_tolerance, snapshot = state->m_timeline]() {
+            auto bake = snapshot.Bake(a_sampleRate, a_tolerance);
+            if (!bake) {
+                log::error("BakeTimeline: Failed to bake timeline {}", a_timelineID);
+                return;
+            }
+            
+            std::shared_lock<std::shared_mutex> mapLock(m_timelinesMutex);
+            auto it = m_timelines.find(a_timelineID);
+            std::unique_lock<std::mutex> editLock;
+            std::unique_lock<std::shared_mutex> stateLock;
+            if (it != m_timelines.end()) {
+                editLock = std::unique_lock<std::mutex>(it->second.m_editLock);
+                stateLock = std::unique_lock<std::shared_mutex>(it->second.m_lock);
+            }
+            if (it == m_timelines.end() || !it->second.m_timeline.SetBake(bake)) {
+                log::info("BakeTimeline: Timeline {} was removed or edited while baking, discarding bake", a_timelineID);
+                return;
+            }
+            if (it->second.m_playingTimeline) {
+                it->second.m_playingTimeline->SetBake(bake);  // Taken by a playing version of the same revision
+            }
+            log::info("BakeTimeline: Baked timeline {} ({} samples)", a_timelineID, bake->GetSampleCount());
+        }).detach();
+        
+        return true;
+    }
+
+    bool TimelineManager::IsTimelineBaked(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return false;
+        }
+        
+        return state->m_timeline.GetBake() != nullptr;
+    }
+
     bool TimelineManager::AllowUserRotation(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_allow) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);  // The flag is published for the hooks
         
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
         
         state->m_allowUserRotation = a_allow;
+        if (m_activeTimelineID == a_timelineID) {
+            PublishPlaybackState(state.m_state);
+        }
         return true;
     }
 
     bool TimelineManager::IsUserRotationAllowed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1279,9 +1689,7 @@ namespace FCFW {
     }
 
     bool TimelineManager::SetFollowGround(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_follow, float a_minHeight) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1292,9 +1700,7 @@ namespace FCFW {
     }
 
     bool TimelineManager::IsGroundFollowingEnabled(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1303,9 +1709,7 @@ namespace FCFW {
     }
 
     float TimelineManager::GetMinHeightAboveGround(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return -1.0f;
         }
@@ -1314,9 +1718,7 @@ namespace FCFW {
     }
 
     bool TimelineManager::SetMenuVisibility(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_show) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1324,7 +1726,7 @@ namespace FCFW {
         state->m_showMenusDuringPlayback = a_show;
         
         // Apply immediately if playback is active
-        if (state->m_isPlaybackRunning && m_activeTimelineID == a_timelineID) {
+        if (state->m_isPlaybackRunning) {
             auto* ui = RE::UI::GetSingleton();
             if (ui) {
                 ui->ShowMenus(a_show);
@@ -1335,9 +1737,7 @@ namespace FCFW {
     }
 
     bool TimelineManager::AreMenusVisible(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = ReadTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1346,9 +1746,7 @@ namespace FCFW {
     }
 
     bool TimelineManager::SetPlaybackMode(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, PlaybackMode a_playbackMode, float a_loopTimeOffset) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
             return false;
         }
@@ -1356,20 +1754,25 @@ namespace FCFW {
         state->m_timeline.SetPlaybackMode(a_playbackMode);
         state->m_timeline.SetLoopTimeOffset(a_loopTimeOffset);
         
+        PublishEdit(state);
         return true;
     }
 
     bool TimelineManager::AddTimelineFromFile(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath, float a_timeOffset) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
-        if (!state) {
-            return false;
-        }
-        
-        if (state->m_isPlaybackRunning) {
-            log::info("{}: Timeline modified during playback, stopping playback", __FUNCTION__);
-            StopPlayback(a_pluginHandle, a_timelineID);
+        TraceRecorder::Scope traceScope("AddTimelineFromFile", a_timelineID);
+        
+        // Parse and import into a copy of the timeline without holding any lock, so a slow import cannot stall playback.
+        // The copy is swapped in afterwards; if the timeline was edited in the meantime, the import is repeated on a copy
+        // of the edited timeline. A failed import never changes the timeline.
+        Timeline imported;
+        std::uint64_t baseRevision = 0;
+        {
+            auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+            if (!state) {
+                return false;
+            }
+            imported = state->m_timeline;
+            baseRevision = state->m_timeline.GetRevision();
         }
         
         std::filesystem::path fullPath = std::filesystem::current_path() / "Data" / a_filePath;
@@ -1381,6 +1784,58 @@ namespace FCFW {
         
         YAML::Node root = YAML::LoadFile(fullPath.string());
         
+        float rotationConversionFactor = 1.0f;  // Default: radians (no conversion)
+        
+        if (root["useDegrees"]) {
+            bool useDegrees = root["useDegrees"].as<bool>();
+            if (useDegrees) {
+                rotationConversionFactor = PI / 180.0f;  // Convert degrees to radians
+            }
+        }
+        
+        auto importPaths = [&](Timeline& a_timeline) {
+            bool importTranslationSuccess = a_timeline.AddTranslationPathFromFile(fullPath.string(), a_timeOffset);
+            bool importRotationSuccess = a_timeline.AddRotationPathFromFile(fullPath.string(), a_timeOffset, rotationConversionFactor);
+            bool importFOVSuccess = a_timeline.AddFOVPathFromFile(fullPath.string(), a_timeOffset);
+            
+            if (!importTranslationSuccess) {
+                log::error("{}: Failed to import translation points from YAML file: {}", __FUNCTION__, a_filePath);
+                return false;
+            }
+            
+            if (!importRotationSuccess) {
+                log::error("{}: Failed to import rotation points from YAML file: {}", __FUNCTION__, a_filePath);
+                return false;
+            }
+            
+            if (!importFOVSuccess) {
+                log::error("{}: Failed to import FOV points from YAML file: {}", __FUNCTION__, a_filePath);
+                return false;
+            }
+            
+            return true;
+        };
+        
+        if (!importPaths(imported)) {
+            return false;
+        }
+        
+        std::unique_lock<std::mutex> playbackLock(m_playbackMutex);  // allowUserRotation is published for the hooks
+        auto state = WriteTimeline(a_timelineID, a_pluginHandle);
+        if (!state) {
+            return false;
+        }
+        
+        if (state->m_timeline.GetRevision() != baseRevision) {
+            // Import again into a copy of the edited timeline; as on the first attempt, a failed import leaves it unchanged
+            log::info("{}: Timeline {} was edited during the import, importing again", __FUNCTION__, a_timelineID);
+            imported = state->m_timeline;
+            if (!importPaths(imported)) {
+                return false;
+            }
+        }
+        state->m_timeline = std::move(imported);
+        
         if (root["playbackMode"]) {
             std::string modeStr = root["playbackMode"].as<std::string>();
             PlaybackMode mode = StringToPlaybackMode(modeStr);
@@ -1410,6 +1865,9 @@ namespace FCFW {
         if (root["allowUserRotation"]) {
             bool allowRotation = root["allowUserRotation"].as<bool>();
             state->m_allowUserRotation = allowRotation;
+            if (m_activeTimelineID == a_timelineID) {
+                PublishPlaybackState(state.m_state);
+            }
         }
         
         if (root["followGround"]) {
@@ -1422,79 +1880,61 @@ namespace FCFW {
             state->m_minHeightAboveGround = minHeight;
         }
         
-        float rotationConversionFactor = 1.0f;  // Default: radians (no conversion)
-        
-        if (root["useDegrees"]) {
-            bool useDegrees = root["useDegrees"].as<bool>();
-            if (useDegrees) {
-                rotationConversionFactor = PI / 180.0f;  // Convert degrees to radians
-            }
-        }
-        
-        bool importTranslationSuccess = state->m_timeline.AddTranslationPathFromFile(fullPath.string(), a_timeOffset);
-        bool importRotationSuccess = state->m_timeline.AddRotationPathFromFile(fullPath.string(), a_timeOffset, rotationConversionFactor);
-        bool importFOVSuccess = state->m_timeline.AddFOVPathFromFile(fullPath.string(), a_timeOffset);
-        
-        if (!importTranslationSuccess) {
-            log::error("{}: Failed to import translation points from YAML file: {}", __FUNCTION__, a_filePath);
-            return false;
-        }
-        
-        if (!importRotationSuccess) {
-            log::error("{}: Failed to import rotation points from YAML file: {}", __FUNCTION__, a_filePath);
-            return false;
-        }
-        
-        if (!importFOVSuccess) {
-            log::error("{}: Failed to import FOV points from YAML file: {}", __FUNCTION__, a_filePath);
-            return false;
-        }
-        
+        playbackLock.unlock();
+        PublishEdit(state);
         return true;
     }
     
     bool TimelineManager::ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        const TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
-        if (!state) {
-            return false;
+        // Write from a copy, so the file I/O runs without holding the timeline's lock
+        TimelineState snapshot;
+        {
+            auto state = EvaluateTimeline(a_timelineID, a_pluginHandle);
+            if (!state) {
+                return false;
+            }
+            snapshot.CopyPersisted(*state.m_state);
         }
         
         std::filesystem::path fullPath = std::filesystem::current_path() / "Data" / a_filePath;
         
 		log::info("{}: Exporting timeline to YAML file: {}", __FUNCTION__, a_filePath);
 		
-		std::ofstream file(fullPath);
+		return WriteTimelineFile(&snapshot, fullPath);
+    }
+
+    bool TimelineManager::WriteTimelineFile(const TimelineState* a_state, const std::filesystem::path& a_fullPath) const {
+		TraceRecorder::Scope traceScope("WriteTimelineFile", a_state->m_id);
+		std::ofstream file(a_fullPath);
 		if (!file.is_open()) {
-			log::error("{}: Failed to open file for writing: {}", __FUNCTION__, fullPath.string());
+			log::error("{}: Failed to open file for writing: {}", __FUNCTION__, a_fullPath.string());
 			return false;
 		}
 		
 		file << "# FreeCameraFramework Timeline (YAML format)\n";
 		file << "formatVersion: 1\n\n";
 		
-    	file << "playbackMode: " << PlaybackModeToString(state->m_timeline.GetPlaybackMode()) << "\n";
-    	file << "loopTimeOffset: " << state->m_timeline.GetLoopTimeOffset() << "\n";
-    	file << "globalEaseIn: " << (state->m_globalEaseIn ? "true" : "false") << "\n";
-    	file << "globalEaseOut: " << (state->m_globalEaseOut ? "true" : "false") << "\n";
-		file << "showMenusDuringPlayback: " << (state->m_showMenusDuringPlayback ? "true" : "false") << "\n";
-		file << "allowUserRotation: " << (state->m_allowUserRotation ? "true" : "false") << "\n";
-		file << "followGround: " << (state->m_followGround ? "true" : "false") << "\n";
-		file << "minHeightAboveGround: " << state->m_minHeightAboveGround << "\n";
+    	file << "playbackMode: " << PlaybackModeToString(a_state->m_timeline.GetPlaybackMode()) << "\n";
+    	file << "loopTimeOffset: " << a_state->m_timeline.GetLoopTimeOffset() << "\n";
+    	file << "globalEaseIn: " << (a_state->m_globalEaseIn ? "true" : "false") << "\n";
+    	file << "globalEaseOut: " << (a_state->m_globalEaseOut ? "true" : "false") << "\n";
+		file << "showMenusDuringPlayback: " << (a_state->m_showMenusDuringPlayback ? "true" : "false") << "\n";
+		file << "allowUserRotation: " << (a_state->m_allowUserRotation ? "true" : "false") << "\n";
+		file << "followGround: " << (a_state->m_followGround ? "true" : "false") << "\n";
+		file << "minHeightAboveGround: " << a_state->m_minHeightAboveGround << "\n";
 		file << "useDegrees: true\n\n";
 		
 		// Export translation, rotation, and FOV paths to same file
-		bool exportTranslationSuccess = state->m_timeline.ExportTranslationPath(file);
+		bool exportTranslationSuccess = a_state->m_timeline.ExportTranslationPath(file);
 		file << "\n";  // Separate the sections
-		bool exportRotationSuccess = state->m_timeline.ExportRotationPath(file, 180.0f / PI);
+		bool exportRotationSuccess = a_state->m_timeline.ExportRotationPath(file, 180.0f / PI);
 		file << "\n";  // Separate the sections
-		bool exportFOVSuccess = state->m_timeline.ExportFOVPath(file);
+		bool exportFOVSuccess = a_state->m_timeline.ExportFOVPath(file);
 		
 		file.close();
 		
 		if (!exportTranslationSuccess || !exportRotationSuccess || !exportFOVSuccess) {
-			log::error("{}: Failed to export timeline to YAML file: {}", __FUNCTION__, a_filePath);
+			log::error("{}: Failed to export timeline to YAML file: {}", __FUNCTION__, a_fullPath.string());
 			return false;
 		}
 		
@@ -1502,7 +1942,8 @@ namespace FCFW {
     }
 
     bool TimelineManager::RegisterPlugin(SKSE::PluginHandle a_pluginHandle) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);  // Cleanup may end the active playback
+        std::unique_lock<std::shared_mutex> mapLock(m_timelinesMutex);
         
         // Check if plugin was already registered
         if (m_registeredPlugins.contains(a_pluginHandle)) {
@@ -1560,10 +2001,13 @@ namespace FCFW {
                 m_timelines.erase(it);
             }
         }
+        if (m_activeTimelineID == 0) {
+            PublishPlaybackState(nullptr);
+        }
     }
 
     size_t TimelineManager::RegisterTimeline(SKSE::PluginHandle a_pluginHandle) {        
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        std::unique_lock<std::shared_mutex> mapLock(m_timelinesMutex);
         
         // Require plugin registration first
         if (!m_registeredPlugins.contains(a_pluginHandle)) {
@@ -1573,18 +2017,18 @@ namespace FCFW {
         
         size_t newID = m_nextTimelineID.fetch_add(1);
         
-        TimelineState state;
+        TimelineState& state = m_timelines[newID];  // Constructed in place, the lock makes it immovable
         state.Initialize(newID, a_pluginHandle);
         
         log::info("{}: Timeline {} registered by plugin '{}' (handle {})", __FUNCTION__, newID, state.m_ownerName, a_pluginHandle);
         
-        m_timelines[newID] = std::move(state);
-        
         return newID;
     }
 
     bool TimelineManager::UnregisterTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
+        DeferredEvents deferredEvents;
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
+        std::unique_lock<std::shared_mutex> mapLock(m_timelinesMutex);  // Exclusive: covers the timeline's own lock
         
         TimelineState* state = GetTimeline(a_timelineID, a_pluginHandle);
         if (!state) {
@@ -1595,10 +2039,10 @@ namespace FCFW {
         if (m_activeTimelineID == a_timelineID) {
             if (state->m_isPlaybackRunning) {
                 log::info("{}: Stopping playback before unregistering timeline {}", __FUNCTION__, a_timelineID);
-                StopPlayback(a_pluginHandle, a_timelineID);
+                StopPlaybackLocked(state);
             } else if (state->m_isRecording) {
                 log::info("{}: Stopping recording before unregistering timeline {}", __FUNCTION__, a_timelineID);
-                StopRecording(a_pluginHandle, a_timelineID);
+                StopRecordingLocked(state);
             }
         }
         
@@ -1631,33 +2075,74 @@ namespace FCFW {
         return const_cast<TimelineManager*>(this)->GetTimeline(a_timelineID, a_pluginHandle);
     }
 
-    // Overloads for internal use (no ownership validation)
-    bool TimelineManager::IsPlaybackRunning(size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        auto it = m_timelines.find(a_timelineID);
-        if (it == m_timelines.end()) {
-            return false;
+    TimelineManager::TimelineReader TimelineManager::ReadTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle) const {
+        TimelineReader access;
+        access.m_mapLock = std::shared_lock<std::shared_mutex>(m_timelinesMutex);
+        access.m_state = GetTimeline(a_timelineID, a_pluginHandle);
+        if (!access.m_state) {
+            return {};
         }
-        
-        return it->second.m_isPlaybackRunning;
+        access.m_stateLock = std::shared_lock<std::shared_mutex>(access.m_state->m_lock);
+        return access;
     }
 
-    bool TimelineManager::IsUserRotationAllowed(size_t a_timelineID) const {
-        std::lock_guard<std::recursive_mutex> lock(m_timelineMutex);
-        
-        auto it = m_timelines.find(a_timelineID);
-        if (it == m_timelines.end()) {
-            return false;
+    TimelineManager::TimelineEvaluator TimelineManager::EvaluateTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle) const {
+        TimelineEvaluator access;
+        access.m_mapLock = std::shared_lock<std::shared_mutex>(m_timelinesMutex);
+        access.m_state = GetTimeline(a_timelineID, a_pluginHandle);
+        if (!access.m_state) {
+            return {};
+        }
+        access.m_editLock = std::unique_lock<std::mutex>(access.m_state->m_editLock);
+        return access;
+    }
+
+    TimelineManager::TimelineWriter TimelineManager::WriteTimeline(size_t a_timelineID, SKSE::PluginHandle a_pluginHandle) {
+        TimelineWriter access;
+        access.m_mapLock = std::shared_lock<std::shared_mutex>(m_timelinesMutex);
+        access.m_state = GetTimeline(a_timelineID, a_pluginHandle);
+        if (!access.m_state) {
+            return {};
+        }
+        access.m_editLock = std::unique_lock<std::mutex>(access.m_state->m_editLock);
+        access.m_stateLock = std::unique_lock<std::shared_mutex>(access.m_state->m_lock);
+        return access;
+    }
+
+    // A playing timeline gets a copy of the edited m_timeline as its next version (see TimelineVersionSlot). m_timeline
+    // only changes while both timeline locks are held, so the copy is taken under the edit lock alone: the frame takes
+    // m_lock and does not wait for it. Shared keys are built after releasing both. The map lock stays held, the timeline
+    // cannot be removed before the version is published.
+    void TimelineManager::PublishEdit(TimelineWriter& a_state, std::shared_ptr<Timeline> a_version) {
+        if (!a_state->m_isPlaybackRunning) {
+            return;
         }
         
-        return it->second.m_allowUserRotation;
+        a_state.m_stateLock.unlock();
+        if (!a_version) {
+            a_version = std::make_shared<Timeline>(a_state->m_timeline);
+        }
+        a_state.m_editLock.unlock();
+        a_version->PrepareForPlayback();
+        a_state.m_state->m_publishedTimeline.Publish(std::move(a_version));
+    }
+
+    void TimelineManager::PublishPlaybackState(const TimelineState* a_activeState) {
+        PlaybackSnapshot snapshot;
+        if (a_activeState) {
+            snapshot.m_activeTimelineID = m_activeTimelineID;
+            snapshot.m_isPlaybackRunning = a_activeState->m_isPlaybackRunning;
+            snapshot.m_isRecording = a_activeState->m_isRecording;
+            snapshot.m_allowUserRotation = a_activeState->m_allowUserRotation;
+        }
+        m_playbackState.Publish(snapshot);
     }
 
     void TimelineManager::RecordTimeline(TimelineState* a_state) {
         if (!a_state || !a_state->m_isRecording) {
             return;
         }
+        FrameProfiler::ScopedTimer recordTimer(FrameStage::kRecord);
         
         auto* playerCamera = RE::PlayerCamera::GetSingleton();
         if (!playerCamera) {
@@ -1698,6 +2183,8 @@ namespace FCFW {
     }
 
     void TimelineManager::OnPreSaveGame() {
+        std::lock_guard<std::mutex> playbackLock(m_playbackMutex);
+        
         if (!m_activeTimelineID) {
             return;
         }
@@ -0,0 +1,155 @@
+#include "TraceRecorder.h"
+
+#include <fstream>
+#include <thread>
+
+namespace FCFW {
+    namespace {
+        // Published copy of a ring event, owned by the writer thread
+        struct TraceEvent {
+            const char* m_name;
+            std::int64_t m_start;
+            std::int64_t m_duration;
+            std::uint64_t m_timelineID;
+            std::uint32_t m_thread;
+        };
+
+        void WriteTraceFile(const std::filesystem::path& a_filePath, const std::vector<TraceEvent>& a_events) {
+            std::filesystem::create_directories(a_filePath.parent_path());
+            std::ofstream file(a_filePath, std::ios::trunc);
+            if (!file) {
+                log::error("TraceRecorder: Failed to open {} for writing", a_filePath.string());
+                return;
+            }
+
+            // Timestamps in microseconds with nanosecond fractions
+            file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+            bool first = true;
+            for (const auto& event : a_events) {
+                if (!first) {
+                    file << ",\n";
+                }
+                first = false;
+                file << fmt::format("{{\"name\":\"{}\",\"cat\":\"fcfw\",\"pid\":1,\"tid\":{},\"ts\":{:.3f}", event.m_name, event.m_thread, static_cast<double>(event.m_start) / 1000.0);
+                if (event.m_duration < 0) {
+                    file << ",\"ph\":\"i\",\"s\":\"g\"";
+                } else {
+                    file << fmt::format(",\"ph\":\"X\",\"dur\":{:.3f}", static_cast<double>(event.m_duration) / 1000.0);
+                }
+                if (event.m_timelineID != 0) {
+                    file << fmt::format(",\"args\":{{\"timeline\":{}}}", event.m_timelineID);
+                }
+                file << "}";
+            }
+            file << "\n]}\n";
+            log::info("TraceRecorder: Wrote {} events to {}", a_events.size(), a_filePath.string());
+        }
+    }
+
+    void TraceRecorder::SetCapacity(std::size_t a_capacity) {
+        std::lock_guard<std::mutex> lock(m_flushLock);
+        if (!m_events) {
+            m_capacity = std::max<std::size_t>(a_capacity, 1024);
+        }
+    }
+
+    bool TraceRecorder::Arm(const std::filesystem::path& a_filePath) {
+        std::lock_guard<std::mutex> lock(m_flushLock);
+
+        if (IsArmed()) {
+            log::warn("{}: Trace already recording to {}", __FUNCTION__, m_filePath.string());
+            return false;
+        }
+        if (!m_events) {
+            m_events = std::make_unique<Event[]>(m_capacity);
+        }
+
+        m_filePath = a_filePath;
+        m_flushCount = 0;
+        m_origin = Clock::now();
+        m_flushedIndex = m_writeIndex.load(std::memory_order_acquire);
+        s_armed.store(true, std::memory_order_release);
+        log::info("{}: Tracing to {} ({} event ring)", __FUNCTION__, m_filePath.string(), m_capacity);
+        return true;
+    }
+
+    void TraceRecorder::Disarm() {
+        if (!IsArmed()) {
+            return;
+        }
+        Flush();
+        s_armed.store(false, std::memory_order_release);
+        log::info("{}: Tracing stopped", __FUNCTION__);
+    }
+
+    bool TraceRecorder::Flush() {
+        std::lock_guard<std::mutex> lock(m_flushLock);
+
+        if (!IsArmed()) {
+            return false;
+        }
+
+        const std::uint64_t end = m_writeIndex.load(std::memory_order_acquire);
+        const std::uint64_t begin = std::max(m_flushedIndex, end > m_capacity ? end - m_capacity : 0);
+        if (begin > m_flushedIndex) {
+            log::warn("{}: Trace ring wrapped, {} events lost", __FUNCTION__, begin - m_flushedIndex);
+        }
+        // Copy up to the first event that is claimed but not yet published; it and everything after it stay
+        // for the next flush. A slot already reclaimed by a newer event (the ring wrapped during the copy) is lost.
+        std::vector<TraceEvent> events;
+        events.reserve(static_cast<std::size_t>(end - begin));
+        std::uint64_t index = begin;
+        for (; index < end; ++index) {
+            const Event& slot = m_events[index % m_capacity];
+            const std::uint64_t sequence = slot.m_sequence.load(std::memory_order_acquire);
+            if (sequence == index + 1) {
+                TraceEvent event{ slot.m_name, slot.m_start, slot.m_duration, slot.m_timelineID, slot.m_thread };
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.m_sequence.load(std::memory_order_relaxed) == index + 1) {
+                    events.push_back(event);
+                }
+            } else if (sequence < index + 1) {
+                break;
+            }
+        }
+        m_flushedIndex = index;
+        if (events.empty()) {
+            return false;
+        }
+
+        std::thread([filePath = GetFlushPath(), events = std::move(events)]() {
+            WriteTraceFile(filePath, events);
+        }).detach();
+        ++m_flushCount;
+        return true;
+    }
+
+    void TraceRecorder::Push(const char* a_name, Clock::time_point a_start, Clock::duration a_duration, std::uint64_t a_timelineID) {
+        const std::uint64_t index = m_writeIndex.fetch_add(1, std::memory_order_relaxed);
+        Event& slot = m_events[index % m_capacity];
+        slot.m_sequence.store(0, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.m_name = a_name;
+        slot.m_start = std::chrono::duration_cast<std::chrono::nanoseconds>(a_start - m_origin).count();
+        slot.m_duration = a_duration.count() < 0 ? -1 : std::chrono::duration_cast<std::chrono::nanoseconds>(a_duration).count();
+        slot.m_timelineID = a_timelineID;
+        slot.m_thread = GetThreadIndex();
+        slot.m_sequence.store(index + 1, std::memory_order_release);
+    }
+
+    std::filesystem::path TraceRecorder::GetFlushPath() const {
+        if (m_flushCount == 0) {
+            return m_filePath;
+        }
+        std::filesystem::path path = m_filePath;
+        path.replace_filename(fmt::format("{}_{}{}", m_filePath.stem().string(), m_flushCount + 1, m_filePath.extension().string()));
+        return path;
+    }
+
+    std::uint32_t TraceRecorder::GetThreadIndex() {
+        // Small stable ids in order of first use; the game's main thread is normally 1
+        static std::atomic<std::uint32_t> s_nextThreadIndex{ 1 };
+        thread_local const std::uint32_t t_threadIndex = s_nextThreadIndex.fetch_add(1, std::memory_order_relaxed);
+        return t_threadIndex;
+    }
+} // namespace FCFW
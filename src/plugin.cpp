@@ -3,6 +3,9 @@
 #include "ModAPI.h"
 #include "CameraTypes.h"
 #include "APIManager.h"
+#include "ReferenceCache.h"
+#include "FrameProfiler.h"
+#include "TraceRecorder.h"
 
 namespace FCFW {
     namespace Interface {
@@ -19,7 +22,7 @@ namespace FCFW {
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -34,7 +37,7 @@ namespace FCFW {
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -48,7 +51,7 @@ namespace FCFW {
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -62,7 +65,7 @@ namespace FCFW {
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -76,7 +79,7 @@ namespace FCFW {
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -92,7 +95,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -107,7 +110,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -121,7 +124,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -137,7 +140,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -153,7 +156,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1;
@@ -162,12 +165,73 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             return FCFW::TimelineManager::GetSingleton().AddFOVPoint(handle, static_cast<size_t>(a_timelineID), a_time, a_fov, a_easeIn, a_easeOut, ToInterpolationMode(a_interpolationMode));
         }
 
+        int AddTranslationPoints(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, std::vector<float> a_times, std::vector<float> a_posX, std::vector<float> a_posY, std::vector<float> a_posZ, bool a_easeIn, bool a_easeOut, int a_interpolationMode) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return -1;
+            }
+
+            if (a_posX.size() != a_times.size() || a_posY.size() != a_times.size() || a_posZ.size() != a_times.size()) {
+                log::error("{}: Coordinate arrays must have one entry per time ({})", __FUNCTION__, a_times.size());
+                return -1;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return -1;
+            }
+
+            std::vector<RE::NiPoint3> positions(a_times.size());
+            for (size_t i = 0; i < a_times.size(); ++i) {
+                positions[i] = RE::NiPoint3(a_posX[i], a_posY[i], a_posZ[i]);
+            }
+            return FCFW::TimelineManager::GetSingleton().AddTranslationPoints(handle, static_cast<size_t>(a_timelineID), a_times, positions, a_easeIn, a_easeOut, ToInterpolationMode(a_interpolationMode));
+        }
+
+        int AddRotationPoints(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, std::vector<float> a_times, std::vector<float> a_pitch, std::vector<float> a_yaw, std::vector<float> a_roll, bool a_easeIn, bool a_easeOut, int a_interpolationMode) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return -1;
+            }
+
+            if (a_pitch.size() != a_times.size() || a_yaw.size() != a_times.size() || a_roll.size() != a_times.size()) {
+                log::error("{}: Angle arrays must have one entry per time ({})", __FUNCTION__, a_times.size());
+                return -1;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return -1;
+            }
+
+            // Convert from degrees (Papyrus convention) to radians (C++ API)
+            std::vector<RE::NiPoint3> rotations(a_times.size());
+            for (size_t i = 0; i < a_times.size(); ++i) {
+                rotations[i] = RE::NiPoint3{PI / 180.f * a_pitch[i], PI / 180.f * a_roll[i], PI / 180.f * a_yaw[i]};
+            }
+            return FCFW::TimelineManager::GetSingleton().AddRotationPoints(handle, static_cast<size_t>(a_timelineID), a_times, rotations, a_easeIn, a_easeOut, ToInterpolationMode(a_interpolationMode));
+        }
+
+        int AddFOVPoints(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, std::vector<float> a_times, std::vector<float> a_fovs, bool a_easeIn, bool a_easeOut, int a_interpolationMode) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return -1;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return -1;
+            }
+
+            return FCFW::TimelineManager::GetSingleton().AddFOVPoints(handle, static_cast<size_t>(a_timelineID), a_times, a_fovs, a_easeIn, a_easeOut, ToInterpolationMode(a_interpolationMode));
+        }
+
         bool StartRecording(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, float a_recordingInterval, bool a_append, float a_timeOffset) {
             if (a_modName.empty() || a_timelineID <= 0) {
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -181,7 +245,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -195,7 +259,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -209,7 +273,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -223,7 +287,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -237,7 +301,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
                 if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -251,7 +315,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0;
@@ -265,7 +329,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0;
@@ -279,7 +343,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0;
@@ -293,7 +357,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0.0f;
@@ -308,7 +372,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0.0f;
@@ -323,7 +387,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0.0f;
@@ -338,7 +402,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0.0f;
@@ -354,7 +418,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0.0f;
@@ -370,7 +434,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 0.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 0.0f;
@@ -386,7 +450,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return 80.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return 80.0f;
@@ -395,12 +459,159 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             return FCFW::TimelineManager::GetSingleton().GetFOVPoint(handle, static_cast<size_t>(a_timelineID), static_cast<size_t>(a_index));
         }
 
+        std::vector<float> GetTranslationPoints(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return {};
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return {};
+            }
+
+            std::vector<float> times;
+            std::vector<RE::NiPoint3> positions;
+            if (!FCFW::TimelineManager::GetSingleton().GetTranslationPoints(handle, static_cast<size_t>(a_timelineID), times, positions)) {
+                return {};
+            }
+
+            // 4 floats per point: time, x, y, z
+            std::vector<float> result;
+            result.reserve(times.size() * 4);
+            for (size_t i = 0; i < times.size(); ++i) {
+                result.push_back(times[i]);
+                result.push_back(positions[i].x);
+                result.push_back(positions[i].y);
+                result.push_back(positions[i].z);
+            }
+            return result;
+        }
+
+        std::vector<float> GetRotationPoints(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return {};
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return {};
+            }
+
+            std::vector<float> times;
+            std::vector<RE::NiPoint3> rotations;
+            if (!FCFW::TimelineManager::GetSingleton().GetRotationPoints(handle, static_cast<size_t>(a_timelineID), times, rotations)) {
+                return {};
+            }
+
+            // 4 floats per point: time, pitch, yaw, roll (degrees, Papyrus convention; same order as AddRotationPoints)
+            std::vector<float> result;
+            result.reserve(times.size() * 4);
+            for (size_t i = 0; i < times.size(); ++i) {
+                result.push_back(times[i]);
+                result.push_back(rotations[i].x * 180.f / PI);
+                result.push_back(rotations[i].z * 180.f / PI);
+                result.push_back(rotations[i].y * 180.f / PI);
+            }
+            return result;
+        }
+
+        std::vector<float> GetFOVPoints(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return {};
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return {};
+            }
+
+            std::vector<float> times;
+            std::vector<float> fovs;
+            if (!FCFW::TimelineManager::GetSingleton().GetFOVPoints(handle, static_cast<size_t>(a_timelineID), times, fovs)) {
+                return {};
+            }
+
+            // 2 floats per point: time, fov
+            std::vector<float> result;
+            result.reserve(times.size() * 2);
+            for (size_t i = 0; i < times.size(); ++i) {
+                result.push_back(times[i]);
+                result.push_back(fovs[i]);
+            }
+            return result;
+        }
+
+        std::vector<float> SampleTimeline(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, std::vector<float> a_times) {
+            if (a_modName.empty() || a_timelineID <= 0 || a_times.empty()) {
+                return {};
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return {};
+            }
+
+            const size_t count = a_times.size();
+            std::vector<RE::NiPoint3> translations(count);
+            std::vector<RE::NiPoint3> rotations(count);
+            std::vector<float> fovs(count);
+            if (!FCFW::TimelineManager::GetSingleton().SampleTimeline(handle, static_cast<size_t>(a_timelineID), a_times, translations, rotations, fovs)) {
+                return {};
+            }
+
+            // 7 floats per sample: x, y, z, pitch, yaw, roll (degrees, Papyrus convention; same order as AddRotationPoint), fov
+            std::vector<float> result;
+            result.reserve(count * 7);
+            for (size_t i = 0; i < count; ++i) {
+                result.push_back(translations[i].x);
+                result.push_back(translations[i].y);
+                result.push_back(translations[i].z);
+                result.push_back(rotations[i].x * 180.f / PI);
+                result.push_back(rotations[i].z * 180.f / PI);
+                result.push_back(rotations[i].y * 180.f / PI);
+                result.push_back(fovs[i]);
+            }
+            return result;
+        }
+
+        bool BakeTimeline(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, float a_sampleRate, float a_tolerance) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return false;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return false;
+            }
+
+            return FCFW::TimelineManager::GetSingleton().BakeTimeline(handle, static_cast<size_t>(a_timelineID), a_sampleRate, a_tolerance);
+        }
+
+        bool IsTimelineBaked(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return false;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return false;
+            }
+
+            return FCFW::TimelineManager::GetSingleton().IsTimelineBaked(handle, static_cast<size_t>(a_timelineID));
+        }
+
         bool StartPlayback(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, float a_startTime) {
             if (a_modName.empty() || a_timelineID <= 0) {
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -408,13 +619,55 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
 
             return FCFW::TimelineManager::GetSingleton().StartPlayback(handle, static_cast<size_t>(a_timelineID), a_speed, a_globalEaseIn, a_globalEaseOut, a_useDuration, a_duration, a_startTime);
         }
+
+        bool StartPlaybackAtConstantSpeed(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, float a_startTime) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return false;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return false;
+            }
+
+            return FCFW::TimelineManager::GetSingleton().StartPlayback(handle, static_cast<size_t>(a_timelineID), a_speed, a_globalEaseIn, a_globalEaseOut, a_useDuration, a_duration, a_startTime, true);
+        }
+
+        float GetTranslationPathLength(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return 0.0f;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return 0.0f;
+            }
+
+            return FCFW::TimelineManager::GetSingleton().GetTranslationPathLength(handle, static_cast<size_t>(a_timelineID));
+        }
+
+        bool AutoRetimeByDistance(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
+            if (a_modName.empty() || a_timelineID <= 0) {
+                return false;
+            }
+
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
+            if (handle == 0) {
+                log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
+                return false;
+            }
+
+            return FCFW::TimelineManager::GetSingleton().AutoRetimeByDistance(handle, static_cast<size_t>(a_timelineID));
+        }
         
         bool StopPlayback(RE::StaticFunctionTag*, RE::BSFixedString a_modName, int a_timelineID) {
             if (a_modName.empty() || a_timelineID <= 0) {
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -428,7 +681,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -442,7 +695,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -456,7 +709,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -470,7 +723,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -484,7 +737,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -498,7 +751,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -516,7 +769,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1.0f;
@@ -530,7 +783,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -544,7 +797,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -558,7 +811,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -572,7 +825,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -586,7 +839,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return -1.0f;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return -1.0f;
@@ -600,7 +853,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -614,7 +867,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -628,7 +881,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -649,7 +902,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
             
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -663,7 +916,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
                 return false;
             }
 
-            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName.c_str());
+            SKSE::PluginHandle handle = FCFW::ModNameToHandle(a_modName);
             if (handle == 0) {
                 log::error("{}: Invalid mod name '{}' - mod not loaded or doesn't exist", __FUNCTION__, a_modName.c_str());
                 return false;
@@ -699,6 +952,13 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             // Convert from radians (C++ API) to degrees (Papyrus convention)
             return rot.z * 180.f / PI;  // Yaw
         }
+
+        std::vector<float> GetCameraState(RE::StaticFunctionTag*) {
+            const RE::NiPoint3 pos = _ts_SKSEFunctions::GetCameraPos();
+            const RE::NiPoint3 rot = _ts_SKSEFunctions::GetCameraRotation();
+            // x, y, z, pitch, yaw, roll (degrees, Papyrus convention)
+            return { pos.x, pos.y, pos.z, rot.x * 180.f / PI, rot.z * 180.f / PI, rot.y * 180.f / PI };
+        }
         
         void RegisterForTimelineEvents(RE::StaticFunctionTag*, RE::TESForm* a_form) {
             if (!a_form) {
@@ -722,8 +982,21 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             FCFW::TimelineManager::GetSingleton().ToggleBodyPartRotationMatrixDisplay(a_actor, static_cast<BodyPart>(a_bodyPart));
         }
 
+        bool StartFrameCapture(RE::StaticFunctionTag*, RE::BSFixedString a_filePath) {
+            if (a_filePath.empty()) {
+                return false;
+            }
+            return FCFW::TimelineManager::GetSingleton().StartFrameCapture(a_filePath.c_str());
+        }
+
+        void StopFrameCapture(RE::StaticFunctionTag*) {
+            FCFW::TimelineManager::GetSingleton().StopFrameCapture();
+        }
+
         bool FCFWFunctions(RE::BSScript::Internal::VirtualMachine * a_vm){
             a_vm->RegisterFunction("ToggleBodyPartRotationMatrixDisplay", "FCFW_SKSEFunctions", ToggleBodyPartRotationMatrixDisplay);
+            a_vm->RegisterFunction("StartFrameCapture", "FCFW_SKSEFunctions", StartFrameCapture);
+            a_vm->RegisterFunction("StopFrameCapture", "FCFW_SKSEFunctions", StopFrameCapture);
             a_vm->RegisterFunction("GetPluginVersion", "FCFW_SKSEFunctions", GetFCFWPluginVersion);
             a_vm->RegisterFunction("RegisterPlugin", "FCFW_SKSEFunctions", RegisterPlugin);
             a_vm->RegisterFunction("RegisterTimeline", "FCFW_SKSEFunctions", RegisterTimeline);
@@ -735,6 +1008,9 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             a_vm->RegisterFunction("AddRotationPoint", "FCFW_SKSEFunctions", AddRotationPoint);
             a_vm->RegisterFunction("AddRotationPointAtRef", "FCFW_SKSEFunctions", AddRotationPointAtRef);
             a_vm->RegisterFunction("AddFOVPoint", "FCFW_SKSEFunctions", AddFOVPoint);
+            a_vm->RegisterFunction("AddTranslationPoints", "FCFW_SKSEFunctions", AddTranslationPoints);
+            a_vm->RegisterFunction("AddRotationPoints", "FCFW_SKSEFunctions", AddRotationPoints);
+            a_vm->RegisterFunction("AddFOVPoints", "FCFW_SKSEFunctions", AddFOVPoints);
             a_vm->RegisterFunction("StartRecording", "FCFW_SKSEFunctions", StartRecording);
             a_vm->RegisterFunction("StopRecording", "FCFW_SKSEFunctions", StopRecording);
             a_vm->RegisterFunction("RemoveTranslationPoint", "FCFW_SKSEFunctions", RemoveTranslationPoint);
@@ -751,7 +1027,16 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             a_vm->RegisterFunction("GetRotationPointYaw", "FCFW_SKSEFunctions", GetRotationPointYaw);
             a_vm->RegisterFunction("GetRotationPointRoll", "FCFW_SKSEFunctions", GetRotationPointRoll);
             a_vm->RegisterFunction("GetFOVPoint", "FCFW_SKSEFunctions", GetFOVPoint);
+            a_vm->RegisterFunction("GetTranslationPoints", "FCFW_SKSEFunctions", GetTranslationPoints);
+            a_vm->RegisterFunction("GetRotationPoints", "FCFW_SKSEFunctions", GetRotationPoints);
+            a_vm->RegisterFunction("GetFOVPoints", "FCFW_SKSEFunctions", GetFOVPoints);
+            a_vm->RegisterFunction("SampleTimeline", "FCFW_SKSEFunctions", SampleTimeline);
+            a_vm->RegisterFunction("BakeTimeline", "FCFW_SKSEFunctions", BakeTimeline);
+            a_vm->RegisterFunction("IsTimelineBaked", "FCFW_SKSEFunctions", IsTimelineBaked);
             a_vm->RegisterFunction("StartPlayback", "FCFW_SKSEFunctions", StartPlayback);
+            a_vm->RegisterFunction("StartPlaybackAtConstantSpeed", "FCFW_SKSEFunctions", StartPlaybackAtConstantSpeed);
+            a_vm->RegisterFunction("GetTranslationPathLength", "FCFW_SKSEFunctions", GetTranslationPathLength);
+            a_vm->RegisterFunction("AutoRetimeByDistance", "FCFW_SKSEFunctions", AutoRetimeByDistance);
             a_vm->RegisterFunction("StopPlayback", "FCFW_SKSEFunctions", StopPlayback);
             a_vm->RegisterFunction("SwitchPlayback", "FCFW_SKSEFunctions", SwitchPlayback);
             a_vm->RegisterFunction("PausePlayback", "FCFW_SKSEFunctions", PausePlayback);
@@ -780,6 +1065,7 @@ log::error("{}: Invalid mod name '{}' or timeline ID {}", __FUNCTION__, a_modNam
             a_vm->RegisterFunction("GetCameraPosZ", "FCFW_SKSEFunctions", GetCameraPosZ);
             a_vm->RegisterFunction("GetCameraPitch", "FCFW_SKSEFunctions", GetCameraPitch);
             a_vm->RegisterFunction("GetCameraYaw", "FCFW_SKSEFunctions", GetCameraYaw);
+            a_vm->RegisterFunction("GetCameraState", "FCFW_SKSEFunctions", GetCameraState);
             
             return true;
         }
@@ -811,6 +1097,20 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* sks
     }
     log::info("{}: LogLevel: {}, FCFW Plugin version: {}", __FUNCTION__, logLevel, FCFW::Interface::GetFCFWPluginVersion(nullptr));
 
+    // Frame profiler, off unless enabled in the [Profiler] section
+    FCFW::FrameProfiler::GetSingleton().Configure(
+        _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "Enable:Profiler", "SKSE/Plugins/FreeCameraFramework.ini", 0L) != 0,
+        static_cast<float>(_ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "WindowSeconds:Profiler", "SKSE/Plugins/FreeCameraFramework.ini", 10L)),
+        static_cast<float>(_ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "LogIntervalSeconds:Profiler", "SKSE/Plugins/FreeCameraFramework.ini", 0L)),
+        _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "LogOnStop:Profiler", "SKSE/Plugins/FreeCameraFramework.ini", 1L) != 0);
+
+    // Chrome trace recording from startup, flushed at every playback stop ([Trace] section)
+    auto& traceRecorder = FCFW::TraceRecorder::GetSingleton();
+    traceRecorder.SetCapacity(static_cast<std::size_t>(std::max(_ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "BufferEvents:Trace", "SKSE/Plugins/FreeCameraFramework.ini", 131072L), 0L)));
+    if (_ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "Enable:Trace", "SKSE/Plugins/FreeCameraFramework.ini", 0L) != 0) {
+        traceRecorder.Arm(std::filesystem::current_path() / "Data" / "SKSE" / "Plugins" / "FreeCameraFramework_Trace.json");
+    }
+
     if (!SKSE::GetPapyrusInterface()->Register(FCFW::Interface::FCFWFunctions)) {
         log::warn("{}: Failed to register Papyrus functions.", __FUNCTION__);
         return false;
@@ -834,6 +1134,7 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* sks
                 break;
             case SKSE::MessagingInterface::kDataLoaded:
                 APIs::RequestAPIs();
+                FCFW::BodyPartNodeCache::GetSingleton().Register();
                 break;
             case SKSE::MessagingInterface::kPostLoad:
                 APIs::RequestAPIs();
@@ -869,7 +1170,13 @@ extern "C" DLLEXPORT void* SKSEAPI RequestPluginAPI(const FCFW_API::InterfaceVer
 	switch (a_interfaceVersion) {
 	case FCFW_API::InterfaceVersion::V1:
 		log::info("{} returned the API singleton", __FUNCTION__);
-		return static_cast<void*>(api);
+		return static_cast<void*>(static_cast<Messaging::InterfaceVersion1*>(api));
+	case FCFW_API::InterfaceVersion::V2:
+		log::info("{} returned the API singleton", __FUNCTION__);
+		return static_cast<void*>(static_cast<Messaging::InterfaceVersion2*>(api));
+	case FCFW_API::InterfaceVersion::V3:
+		log::info("{} returned the API singleton", __FUNCTION__);
+		return static_cast<void*>(static_cast<Messaging::InterfaceVersion3*>(api));
 	}
 
 	log::info("{} requested the wrong interface version", __FUNCTION__);